@@ -23,11 +23,24 @@
 #ifndef LITESIMD_ALGORITHM_H
 #define LITESIMD_ALGORITHM_H
 
+#include <litesimd/types.h>
+
 #include <litesimd/detail/arch/sse/algorithm.h>
 #include <litesimd/detail/arch/avx/algorithm.h>
+#include <litesimd/algorithm/binary_search.h>
 #include <litesimd/algorithm/for_each.h>
+#include <litesimd/algorithm/histogram.h>
 #include <litesimd/algorithm/iota.h>
+#include <litesimd/algorithm/merge.h>
 #include <litesimd/algorithm/minmax.h>
+#include <litesimd/algorithm/partition.h>
+#include <litesimd/algorithm/radix_sort.h>
+#include <litesimd/algorithm/reduce.h>
+#include <litesimd/algorithm/set_operations.h>
+#include <litesimd/algorithm/sort.h>
+#include <litesimd/algorithm/sorting_network.h>
+#include <litesimd/algorithm/transform.h>
+#include <litesimd/algorithm/unique.h>
 #include <litesimd/intravector.h>
 
 /**
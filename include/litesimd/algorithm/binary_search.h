@@ -0,0 +1,573 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_BINARY_SEARCH_H
+#define LITESIMD_ALGORITHM_BINARY_SEARCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/bitwise.h>
+#include <litesimd/shuffle.h>
+#include <litesimd/arithmetic.h>
+
+namespace litesimd {
+
+namespace detail {
+
+template< size_t Size_T > struct search_int;
+template<> struct search_int< 1 > { using type = int8_t; };
+template<> struct search_int< 2 > { using type = int16_t; };
+template<> struct search_int< 4 > { using type = int32_t; };
+template<> struct search_int< 8 > { using type = int64_t; };
+
+// Type of the SIMD register used to search each value type. Unsigned values have
+// the sign bit flipped, so the signed comparison keeps their order. The type is
+// void when the values can not be compared on SIMD registers.
+template< typename ValueType_T, typename Enable_T = void >
+struct search_traits
+{
+    using type = void;
+};
+
+template< typename ValueType_T >
+struct search_traits< ValueType_T,
+                      typename std::enable_if< std::is_integral< ValueType_T >::value &&
+                                               !std::is_same< ValueType_T, bool >::value >::type >
+{
+    using type = typename search_int< sizeof( ValueType_T ) >::type;
+    using unsigned_type = typename std::make_unsigned< type >::type;
+
+    static type to( ValueType_T val )
+    {
+        constexpr unsigned_type bias = std::is_signed< ValueType_T >::value ? 0 :
+            static_cast< unsigned_type >( std::numeric_limits< type >::min() );
+        return static_cast< type >( static_cast< unsigned_type >( val ) ^ bias );
+    }
+};
+
+template< typename ValueType_T >
+struct search_traits< ValueType_T,
+                      typename std::enable_if< std::is_same< ValueType_T, float >::value ||
+                                               std::is_same< ValueType_T, double >::value >::type >
+{
+    using type = ValueType_T;
+    static type to( ValueType_T val ) { return val; }
+};
+
+template< typename ValueType_T >
+struct is_searchable
+    : std::integral_constant< bool, !std::is_void< typename search_traits< ValueType_T >::type >::value > {};
+
+// Below this size the n-way split does not pay the gathering of the samples
+constexpr ptrdiff_t search_scalar_size = 32;
+
+// Reads simd_size equally spaced samples of the range and keeps the part between the
+// samples around the key, until the range is small enough for the scalar search
+template< typename Tag_T, bool Upper_T, typename Iterator_T, typename ValueType_T >
+inline Iterator_T nway_bound( Iterator_T first, Iterator_T last, const ValueType_T& key, std::true_type )
+{
+    using traits = search_traits< ValueType_T >;
+    using search_type = typename traits::type;
+    using simd = simd_type< search_type, Tag_T >;
+    using difference_type = typename std::iterator_traits< Iterator_T >::difference_type;
+    constexpr int simd_size = simd::simd_size;
+
+    simd key_vec( traits::to( key ) );
+    alignas( simd ) search_type samples[ simd_size ];
+
+    difference_type size = last - first;
+    while( size >= search_scalar_size && size > simd_size )
+    {
+        difference_type step = size / (simd_size + 1);
+        for( int i = 0; i < simd_size; ++i )
+            samples[ i ] = traits::to( first[ step * (i + 1) ] );
+
+        simd cmp = load< search_type, Tag_T >( samples );
+
+        // Number of samples before the bound
+        int i = Upper_T
+              ? simd_size - bit_count< Tag_T >( mask_to_lane_bitmask< search_type, Tag_T >(
+                                greater< search_type, Tag_T >( cmp, key_vec ) ) )
+              : bit_count< Tag_T >( mask_to_lane_bitmask< search_type, Tag_T >(
+                                greater< search_type, Tag_T >( key_vec, cmp ) ) );
+
+        first += i * step;
+        size = (i == simd_size) ? size - simd_size * step : step + 1;
+    }
+
+    return Upper_T ? std::upper_bound( first, first + size, key )
+                   : std::lower_bound( first, first + size, key );
+}
+
+template< typename Tag_T, bool Upper_T, typename Iterator_T, typename ValueType_T >
+inline Iterator_T nway_bound( Iterator_T first, Iterator_T last, const ValueType_T& key, std::false_type )
+{
+    return Upper_T ? std::upper_bound( first, last, key )
+                   : std::lower_bound( first, last, key );
+}
+
+template< typename Tag_T, bool Upper_T, typename Iterator_T >
+inline Iterator_T nway_bound( Iterator_T first, Iterator_T last,
+                              const typename std::iterator_traits< Iterator_T >::value_type& key )
+{
+    using value_type = typename std::iterator_traits< Iterator_T >::value_type;
+    return nway_bound< Tag_T, Upper_T >( first, last, key, is_searchable< value_type >() );
+}
+
+// Interpolation probes before the search falls back to the n-way split. Uniform keys
+// need about log2( log2( size ) ) probes, the window absorbs the last ones
+constexpr int search_interpolation_probes = 8;
+
+// Values compared around each interpolation probe, a cache line of values
+template< typename ValueType_T, typename Tag_T >
+struct search_interpolation_window
+{
+    constexpr static size_t simd_size = simd_type< typename search_traits< ValueType_T >::type, Tag_T >::simd_size;
+    constexpr static size_t value = (64 / sizeof( ValueType_T ) > simd_size) ? 64 / sizeof( ValueType_T ) : simd_size;
+};
+
+// Probes the position predicted by the values on the ends of the range and counts the
+// values less than the key on the window around it. The range is narrowed to one
+// side of the window when the bound is out of it.
+template< typename Tag_T, typename Iterator_T, typename ValueType_T >
+inline Iterator_T interpolation_bound( Iterator_T first, Iterator_T last, const ValueType_T& key, std::true_type )
+{
+    using traits = search_traits< ValueType_T >;
+    using search_type = typename traits::type;
+    using unsigned_type = typename traits::unsigned_type;
+    using simd = simd_type< search_type, Tag_T >;
+    using difference_type = typename std::iterator_traits< Iterator_T >::difference_type;
+    constexpr difference_type window = search_interpolation_window< ValueType_T, Tag_T >::value;
+
+    simd key_vec( traits::to( key ) );
+    alignas( simd ) search_type samples[ window ];
+
+    // The bound is inside [lo, hi]
+    difference_type lo = 0;
+    difference_type hi = last - first;
+    for( int probe = 0; probe < search_interpolation_probes && hi - lo > window; ++probe )
+    {
+        search_type low = traits::to( first[ lo ] );
+        search_type high = traits::to( first[ hi - 1 ] );
+        search_type value = traits::to( key );
+        if( !(low < value) )
+            return first + lo;
+        if( high < value )
+            return first + hi;
+
+        // The differences of the mapped values fit on the unsigned type
+        double ratio = static_cast< double >( static_cast< unsigned_type >( static_cast< unsigned_type >( value )
+                                                                          - static_cast< unsigned_type >( low ) ) )
+                     / static_cast< double >( static_cast< unsigned_type >( static_cast< unsigned_type >( high )
+                                                                          - static_cast< unsigned_type >( low ) ) );
+        difference_type pos = lo + static_cast< difference_type >( ratio * static_cast< double >( hi - 1 - lo ) );
+        difference_type start = std::min( std::max( pos - window / 2, lo ), hi - window );
+
+        for( difference_type i = 0; i < window; ++i )
+            samples[ i ] = traits::to( first[ start + i ] );
+        difference_type count = bit_count< Tag_T >( greater_node_bitmask< window >( key_vec, samples ) );
+
+        if( count == 0 )
+            hi = start;
+        else if( count == window )
+            lo = start + window;
+        else
+            return first + start + count;
+    }
+
+    // Short ranges and distributions where the interpolation degrades
+    return nway_bound< Tag_T, false >( first + lo, first + hi, key, std::true_type() );
+}
+
+template< typename Tag_T, typename Iterator_T, typename ValueType_T >
+inline Iterator_T interpolation_bound( Iterator_T first, Iterator_T last, const ValueType_T& key, std::false_type )
+{
+    return nway_bound< Tag_T, false >( first, last, key );
+}
+
+// Keys searched at the same time by lower_bound_batch
+constexpr size_t search_batch_group = 16;
+
+// Branchless binary search of a group of keys, one step of all keys at a time. The
+// next probe of each key is prefetched after its step, so the loads of all keys of
+// the group are in flight together instead of paying the memory latency one by one
+template< typename Tag_T, typename Iterator_T, typename Output_T >
+inline Output_T lower_bound_group( Iterator_T first, Iterator_T last,
+                                   const typename std::iterator_traits< Iterator_T >::value_type* keys,
+                                   size_t count, Output_T out )
+{
+    using difference_type = typename std::iterator_traits< Iterator_T >::difference_type;
+
+    difference_type base[ search_batch_group ] = {};
+    difference_type size = last - first;
+    if( size == 0 )
+    {
+        for( size_t g = 0; g < count; ++g )
+            *out++ = 0;
+        return out;
+    }
+
+    while( size > 1 )
+    {
+        difference_type half = size / 2;
+        for( size_t g = 0; g < count; ++g )
+            base[ g ] = (first[ base[ g ] + half ] < keys[ g ]) ? base[ g ] + half : base[ g ];
+
+        size -= half;
+        for( size_t g = 0; g < count; ++g )
+            prefetch< Tag_T >( &*(first + (base[ g ] + size / 2)) );
+    }
+
+    for( size_t g = 0; g < count; ++g )
+        *out++ = static_cast< size_t >( base[ g ] + (first[ base[ g ] ] < keys[ g ]) );
+    return out;
+}
+
+} // namespace detail
+
+/**
+ * \ingroup algorithm
+ * \brief Returns the first position of the sorted range which is not less than the key.
+ *
+ * Each step compares the key with `simd_size` equally spaced values of the range at
+ * once, reducing the range to `1/(simd_size + 1)` of its size, the same n-way split of
+ * the binary_search sample. Ranges with less than 32 values use `std::lower_bound`.
+ *
+ * Works on any random access iterator. Signed and unsigned integers, float and double
+ * are searched with SIMD, other value types use `std::lower_bound`.
+ *
+ * \param first, last Sorted range
+ * \param key Value to search
+ * \returns Iterator to the first value not less than key, or last
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values( 1000 );
+ *     for( int32_t i = 0; i < 1000; ++i )
+ *         values[ i ] = i * 2;
+ *
+ *     auto it = ls::lower_bound( values.begin(), values.end(), 501 );
+ *     std::cout << "lower_bound( 501 ): " << *it << " at " << (it - values.begin()) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * lower_bound( 501 ): 502 at 251
+ * ```
+ *
+ * \see upper_bound, equal_range
+ */
+template< typename Tag_T = default_tag, typename Iterator_T >
+inline Iterator_T lower_bound( Iterator_T first, Iterator_T last,
+                               const typename std::iterator_traits< Iterator_T >::value_type& key )
+{
+    return detail::nway_bound< Tag_T, false >( first, last, key );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Returns the first position of the sorted range which is greater than the key.
+ *
+ * \param first, last Sorted range
+ * \param key Value to search
+ * \returns Iterator to the first value greater than key, or last
+ *
+ * \see lower_bound, equal_range
+ */
+template< typename Tag_T = default_tag, typename Iterator_T >
+inline Iterator_T upper_bound( Iterator_T first, Iterator_T last,
+                               const typename std::iterator_traits< Iterator_T >::value_type& key )
+{
+    return detail::nway_bound< Tag_T, true >( first, last, key );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Returns the range of values equal to the key inside the sorted range.
+ *
+ * \param first, last Sorted range
+ * \param key Value to search
+ * \returns Pair with the lower_bound and the upper_bound of the key
+ *
+ * \see lower_bound, upper_bound
+ */
+template< typename Tag_T = default_tag, typename Iterator_T >
+inline std::pair< Iterator_T, Iterator_T >
+equal_range( Iterator_T first, Iterator_T last,
+             const typename std::iterator_traits< Iterator_T >::value_type& key )
+{
+    Iterator_T lower = detail::nway_bound< Tag_T, false >( first, last, key );
+    return std::make_pair( lower, detail::nway_bound< Tag_T, true >( lower, last, key ) );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Returns the first position of the sorted range which is not less than the key,
+ * interpolating the position of the key from the values.
+ *
+ * Each probe predicts the position of the key from the values on the ends of the
+ * range, as the interpolation search, and compares the key with a cache line of values
+ * around the prediction at once. The search ends when the bound is inside the window,
+ * or narrows the range to one side of it. Uniformly distributed keys are found on
+ * O(log log n) probes, usually one or two.
+ *
+ * Skewed distributions make the interpolation degrade to linear steps, so after 8
+ * probes the search goes on with the n-way split of lower_bound.
+ *
+ * Works on any random access iterator. Signed and unsigned integers are interpolated,
+ * other value types use lower_bound.
+ *
+ * \param first, last Sorted range
+ * \param key Value to search
+ * \returns Iterator to the first value not less than key, or last
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values( 1000 );
+ *     for( int32_t i = 0; i < 1000; ++i )
+ *         values[ i ] = i * 2;
+ *
+ *     auto it = ls::interpolation_lower_bound( values.begin(), values.end(), 501 );
+ *     std::cout << "interpolation_lower_bound( 501 ): " << *it << " at " << (it - values.begin()) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * interpolation_lower_bound( 501 ): 502 at 251
+ * ```
+ *
+ * \see lower_bound
+ */
+template< typename Tag_T = default_tag, typename Iterator_T >
+inline Iterator_T interpolation_lower_bound( Iterator_T first, Iterator_T last,
+                                             const typename std::iterator_traits< Iterator_T >::value_type& key )
+{
+    using value_type = typename std::iterator_traits< Iterator_T >::value_type;
+    return detail::interpolation_bound< Tag_T >( first, last, key,
+                std::integral_constant< bool, std::is_integral< value_type >::value &&
+                                              detail::is_searchable< value_type >::value >() );
+}
+
+
+/**
+ * \ingroup algorithm
+ * \brief Searches the lower_bound of many keys on the same sorted range.
+ *
+ * The keys are searched on groups of 16, interleaving the steps of the binary search
+ * of all keys of the group. Each key prefetches its next probe, so the group has 16
+ * memory accesses in flight, which is much faster than searching the keys one by one
+ * on ranges that do not fit in the cache.
+ *
+ * \param first, last Sorted range
+ * \param keys Array of keys to search
+ * \param count Number of keys
+ * \param out Output iterator receiving the position of the lower_bound of each key,
+ * as the distance from first
+ * \returns Output iterator past the last position written
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values = { 10, 20, 30, 40, 50, 60, 70, 80 };
+ *     std::vector< int32_t > keys = { 35, 5, 80, 90 };
+ *     std::vector< size_t > pos( keys.size() );
+ *     ls::lower_bound_batch( values.begin(), values.end(), keys.data(), keys.size(), pos.begin() );
+ *
+ *     for( auto p : pos )
+ *         std::cout << p << " ";
+ *     std::cout << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * 3 0 7 8
+ * ```
+ *
+ * \see lower_bound
+ */
+template< typename Tag_T = default_tag, typename Iterator_T, typename Output_T >
+inline Output_T lower_bound_batch( Iterator_T first, Iterator_T last,
+                                   const typename std::iterator_traits< Iterator_T >::value_type* keys,
+                                   size_t count, Output_T out )
+{
+    for( ; count >= detail::search_batch_group; count -= detail::search_batch_group )
+    {
+        out = detail::lower_bound_group< Tag_T >( first, last, keys, detail::search_batch_group, out );
+        keys += detail::search_batch_group;
+    }
+    return detail::lower_bound_group< Tag_T >( first, last, keys, count, out );
+}
+
+namespace detail {
+
+template< typename Tag_T, typename ValueType_T >
+inline simd_type< typename search_traits< ValueType_T >::type, Tag_T >
+search_map( simd_type< typename search_traits< ValueType_T >::type, Tag_T > vec )
+{
+    using search_type = typename search_traits< ValueType_T >::type;
+    if( !std::is_unsigned< ValueType_T >::value )
+        return vec;
+    return bit_xor< search_type, Tag_T >( vec, simd_type< search_type, Tag_T >(
+        search_traits< ValueType_T >::to( 0 ) ) );
+}
+
+// Searches simd_size keys on each SIMD register, each lane has its own window of the
+// range. Two registers are searched together to hide the latency of the gathers.
+template< typename Tag_T, typename ValueType_T, typename Output_T >
+inline Output_T lower_bound_vertical( const ValueType_T* first, const ValueType_T* last,
+                                      const ValueType_T* keys, size_t count, Output_T out,
+                                      std::true_type )
+{
+    using search_type = typename search_traits< ValueType_T >::type;
+    using index_type = typename permute_index< search_type >::type;
+    using simd = simd_type< search_type, Tag_T >;
+    using simd_index = simd_type< index_type, Tag_T >;
+    constexpr size_t simd_size = simd::simd_size;
+
+    const ptrdiff_t size = last - first;
+    if( size == 0 || size > static_cast< ptrdiff_t >( std::numeric_limits< index_type >::max() ) )
+        return lower_bound_batch< Tag_T >( first, last, keys, count, out );
+
+    const search_type* values = reinterpret_cast< const search_type* >( first );
+    const search_type* search_keys = reinterpret_cast< const search_type* >( keys );
+    alignas( simd_index ) index_type pos[ 2 * simd_size ];
+
+    size_t i = 0;
+    for( ; i + 2 * simd_size <= count; i += 2 * simd_size )
+    {
+        simd key0 = search_map< Tag_T, ValueType_T >( load< search_type, Tag_T >( search_keys + i ) );
+        simd key1 = search_map< Tag_T, ValueType_T >( load< search_type, Tag_T >( search_keys + i + simd_size ) );
+        simd_index base0 = simd_index::zero();
+        simd_index base1 = simd_index::zero();
+
+        for( ptrdiff_t len = size; len > 1; )
+        {
+            ptrdiff_t half = len / 2;
+            simd_index step( static_cast< index_type >( half ) );
+            simd_index mid0 = add< index_type, Tag_T >( base0, step );
+            simd_index mid1 = add< index_type, Tag_T >( base1, step );
+            simd val0 = search_map< Tag_T, ValueType_T >( gather< search_type, Tag_T >( values, mid0 ) );
+            simd val1 = search_map< Tag_T, ValueType_T >( gather< search_type, Tag_T >( values, mid1 ) );
+
+            // Moves the window of the lanes where the middle value is less than the key
+            base0 = blend< index_type, Tag_T >( reinterpret< index_type >(
+                        greater< search_type, Tag_T >( key0, val0 ) ), mid0, base0 );
+            base1 = blend< index_type, Tag_T >( reinterpret< index_type >(
+                        greater< search_type, Tag_T >( key1, val1 ) ), mid1, base1 );
+            len -= half;
+        }
+
+        // The last value of each window is the lower_bound or the one before it,
+        // the all ones mask is -1
+        simd val0 = search_map< Tag_T, ValueType_T >( gather< search_type, Tag_T >( values, base0 ) );
+        simd val1 = search_map< Tag_T, ValueType_T >( gather< search_type, Tag_T >( values, base1 ) );
+        store< index_type, Tag_T >( pos, sub< index_type, Tag_T >( base0,
+            reinterpret< index_type >( greater< search_type, Tag_T >( key0, val0 ) ) ) );
+        store< index_type, Tag_T >( pos + simd_size, sub< index_type, Tag_T >( base1,
+            reinterpret< index_type >( greater< search_type, Tag_T >( key1, val1 ) ) ) );
+
+        for( size_t j = 0; j < 2 * simd_size; ++j )
+            *out++ = static_cast< size_t >( pos[ j ] );
+    }
+
+    // Scalar finisher for the last keys
+    return lower_bound_batch< Tag_T >( first, last, keys + i, count - i, out );
+}
+
+template< typename Tag_T, typename ValueType_T, typename Output_T >
+inline Output_T lower_bound_vertical( const ValueType_T* first, const ValueType_T* last,
+                                      const ValueType_T* keys, size_t count, Output_T out,
+                                      std::false_type )
+{
+    return lower_bound_batch< Tag_T >( first, last, keys, count, out );
+}
+
+} // namespace detail
+
+/**
+ * \ingroup algorithm
+ * \brief Searches the lower_bound of many keys on the same sorted array, one key on
+ * each lane of the SIMD registers.
+ *
+ * Each lane holds a different key and its own window of the array. On each step the
+ * middle values of all windows are loaded with gather, compared with the keys by
+ * greater and the windows are updated by blend. This is faster than lower_bound_batch
+ * when the array fits in the cache and there are many keys to search.
+ *
+ * Only 32 and 64 bits values use the vertical search, the other types and the last
+ * keys that do not fill the SIMD registers use lower_bound_batch.
+ *
+ * \param first, last Sorted array
+ * \param keys Array of keys to search
+ * \param count Number of keys
+ * \param out Output iterator receiving the position of the lower_bound of each key,
+ * as the distance from first
+ * \returns Output iterator past the last position written
+ *
+ * \see lower_bound_batch, lower_bound
+ */
+template< typename Tag_T = default_tag, typename ValueType_T, typename Output_T >
+inline Output_T lower_bound_vertical( const ValueType_T* first, const ValueType_T* last,
+                                      const ValueType_T* keys, size_t count, Output_T out )
+{
+    return detail::lower_bound_vertical< Tag_T >( first, last, keys, count, out,
+        std::integral_constant< bool, detail::is_searchable< ValueType_T >::value &&
+                                      sizeof( ValueType_T ) >= 4 >() );
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ALGORITHM_BINARY_SEARCH_H
@@ -0,0 +1,90 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_DETAIL_COMPRESS_OUTPUT_H
+#define LITESIMD_ALGORITHM_DETAIL_COMPRESS_OUTPUT_H
+
+#include <cstddef>
+#include <algorithm>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/shuffle.h>
+
+namespace litesimd {
+namespace detail {
+
+// Output of the algorithms writing the values selected by a mask, with compress.
+// The output has room for _last - first_ values, full SIMD stores are used while they fit.
+template< typename ValueType_T >
+struct compress_output
+{
+    compress_output( ValueType_T* first, ValueType_T* last ) : out_( first ), last_( last ) {}
+
+    template< typename Index_T, typename Tag_T >
+    inline void put( simd_type< Index_T, Tag_T > keep, simd_type< Index_T, Tag_T > vec )
+    {
+        constexpr ptrdiff_t simd_size = simd_type< Index_T, Tag_T >::simd_size;
+        int count = bit_count< Tag_T >( mask_to_lane_bitmask< Index_T, Tag_T >( keep ) );
+        simd_type< Index_T, Tag_T > packed = compress< Index_T, Tag_T >( keep, vec );
+        Index_T* out = reinterpret_cast< Index_T* >( out_ );
+        if( last_ - out_ >= simd_size )
+        {
+            store< Index_T, Tag_T >( out, packed );
+        }
+        else
+        {
+            Index_T buffer[ simd_size ];
+            store< Index_T, Tag_T >( buffer, packed );
+            std::copy( buffer, buffer + count, out );
+        }
+        out_ += count;
+    }
+
+    inline void put( const ValueType_T* first, const ValueType_T* last ) { out_ = std::copy( first, last, out_ ); }
+    inline void put( ValueType_T val ) { *out_++ = val; }
+    inline ValueType_T* result() const { return out_; }
+
+    ValueType_T* out_;
+    ValueType_T* last_;
+};
+
+// Same interface of compress_output, only counts the values
+template< typename ValueType_T >
+struct compress_counter
+{
+    template< typename Index_T, typename Tag_T >
+    inline void put( simd_type< Index_T, Tag_T > keep, simd_type< Index_T, Tag_T > )
+    {
+        count_ += bit_count< Tag_T >( mask_to_lane_bitmask< Index_T, Tag_T >( keep ) );
+    }
+
+    inline void put( const ValueType_T* first, const ValueType_T* last ) { count_ += last - first; }
+    inline void put( ValueType_T ) { ++count_; }
+    inline size_t result() const { return count_; }
+
+    size_t count_ = 0;
+};
+
+}} // namespace litesimd::detail
+
+#endif // LITESIMD_ALGORITHM_DETAIL_COMPRESS_OUTPUT_H
@@ -0,0 +1,46 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_DETAIL_GALLOP_H
+#define LITESIMD_ALGORITHM_DETAIL_GALLOP_H
+
+#include <cstddef>
+#include <algorithm>
+
+namespace litesimd {
+namespace detail {
+
+// Exponential search followed by binary search, finds the lower bound close to _first_
+template< typename ValueType_T >
+inline const ValueType_T* gallop_lower_bound( const ValueType_T* first, const ValueType_T* last,
+                                              ValueType_T val )
+{
+    ptrdiff_t size = last - first;
+    ptrdiff_t step = 1;
+    while( step < size && first[ step - 1 ] < val )
+        step *= 2;
+    return std::lower_bound( first + step / 2, first + std::min( step, size ), val );
+}
+
+}} // namespace litesimd::detail
+
+#endif // LITESIMD_ALGORITHM_DETAIL_GALLOP_H
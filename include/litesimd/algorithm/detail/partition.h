@@ -0,0 +1,187 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_DETAIL_PARTITION_H
+#define LITESIMD_ALGORITHM_DETAIL_PARTITION_H
+
+#include <cstddef>
+#include <algorithm>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/bitwise.h>
+#include <litesimd/shuffle.h>
+
+namespace litesimd {
+namespace detail {
+
+// Selects the values lesser than the pivot
+template< typename ValueType_T, typename Tag_T >
+struct less_than_selector
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+
+    less_than_selector( ValueType_T pivot ) : pivot_( pivot ), vpivot_( pivot ) {}
+
+    inline simd mask( simd vec ) const { return greater< ValueType_T, Tag_T >( vpivot_, vec ); }
+    inline bool operator()( ValueType_T val ) const { return val < pivot_; }
+
+    ValueType_T pivot_;
+    simd vpivot_;
+};
+
+// Selects the values lesser or equal to the pivot
+template< typename ValueType_T, typename Tag_T >
+struct less_equal_selector
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+
+    less_equal_selector( ValueType_T pivot ) : pivot_( pivot ), vpivot_( pivot ) {}
+
+    inline simd mask( simd vec ) const
+    {
+        return bit_not< ValueType_T, Tag_T >( greater< ValueType_T, Tag_T >( vec, vpivot_ ) );
+    }
+    inline bool operator()( ValueType_T val ) const { return !(pivot_ < val); }
+
+    ValueType_T pivot_;
+    simd vpivot_;
+};
+
+// Selects the values that are not NaN
+template< typename ValueType_T, typename Tag_T >
+struct ordered_selector
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+
+    inline simd mask( simd vec ) const { return equal_to< ValueType_T, Tag_T >( vec, vec ); }
+    inline bool operator()( ValueType_T val ) const { return val == val; }
+};
+
+// Selects the values with a SIMD predicate and the equivalent scalar predicate
+template< typename ValueType_T, typename Tag_T, typename SimdPredicate_T, typename ScalarPredicate_T >
+struct predicate_selector
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+
+    predicate_selector( SimdPredicate_T simd_pred, ScalarPredicate_T scalar_pred )
+        : simd_pred_( simd_pred ), scalar_pred_( scalar_pred ) {}
+
+    inline simd mask( simd vec ) const { return simd_pred_( vec ); }
+    inline bool operator()( ValueType_T val ) const { return !!scalar_pred_( val ); }
+
+    SimdPredicate_T simd_pred_;
+    ScalarPredicate_T scalar_pred_;
+};
+
+// Stores the selected values at _left_ and the other ones before _right_. The
+// stores write a whole register on each side, so there must be at least
+// simd_size + selected free values between left and right.
+template< typename ValueType_T, typename Tag_T, typename Selector_T >
+inline void partition_store( simd_type< ValueType_T, Tag_T > vec, const Selector_T& sel,
+                             ValueType_T*& left, ValueType_T*& right )
+{
+    constexpr ptrdiff_t simd_size = simd_type< ValueType_T, Tag_T >::simd_size;
+
+    simd_type< ValueType_T, Tag_T > mask = sel.mask( vec );
+    int count = bit_count< Tag_T >( mask_to_lane_bitmask< ValueType_T, Tag_T >( mask ) );
+    simd_type< ValueType_T, Tag_T > packed = compress< ValueType_T, Tag_T >( mask, vec );
+
+    store< ValueType_T, Tag_T >( left, packed );
+    store< ValueType_T, Tag_T >( right - simd_size, packed );
+    left += count;
+    right -= simd_size - count;
+}
+
+// Same as partition_store, but for exactly simd_size free values after left
+template< typename ValueType_T, typename Tag_T, typename Selector_T >
+inline ValueType_T* partition_store_exact( simd_type< ValueType_T, Tag_T > vec,
+                                           const Selector_T& sel, ValueType_T* left )
+{
+    constexpr ptrdiff_t simd_size = simd_type< ValueType_T, Tag_T >::simd_size;
+
+    simd_type< ValueType_T, Tag_T > mask = sel.mask( vec );
+    int count = bit_count< Tag_T >( mask_to_lane_bitmask< ValueType_T, Tag_T >( mask ) );
+
+    ValueType_T packed[ simd_size ];
+    store< ValueType_T, Tag_T >( packed, compress< ValueType_T, Tag_T >( mask, vec ) );
+    std::copy( packed, packed + simd_size, left );
+    return left + count;
+}
+
+// In place partition of [first, last), returns the first value not selected.
+//
+// The first and last registers are saved, so there is free room for one
+// register on each side. Each loop iteration loads one register from the side
+// with less free room and writes the selected values on the left side and the
+// other ones on the right side, with compress and two stores.
+template< typename ValueType_T, typename Tag_T, typename Selector_T >
+inline ValueType_T* simd_partition( ValueType_T* first, ValueType_T* last, const Selector_T& sel )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    constexpr ptrdiff_t simd_size = simd::simd_size;
+
+    if( last - first < 2 * simd_size )
+        return std::partition( first, last, sel );
+
+    simd vec_left = load< ValueType_T, Tag_T >( first );
+    simd vec_right = load< ValueType_T, Tag_T >( last - simd_size );
+
+    ValueType_T* read_left = first + simd_size;
+    ValueType_T* read_right = last - simd_size;
+    ValueType_T* write_left = first;
+    ValueType_T* write_right = last;
+
+    while( read_right - read_left >= simd_size )
+    {
+        simd vec;
+        if( (read_left - write_left) <= (write_right - read_right) )
+        {
+            vec = load< ValueType_T, Tag_T >( read_left );
+            read_left += simd_size;
+        }
+        else
+        {
+            read_right -= simd_size;
+            vec = load< ValueType_T, Tag_T >( read_right );
+        }
+        partition_store< ValueType_T, Tag_T >( vec, sel, write_left, write_right );
+    }
+
+    // Less than one register remaining, the whole [write_left, write_right) is free after the copy
+    ValueType_T remaining[ simd_size ];
+    ValueType_T* remaining_end = std::copy( read_left, read_right, remaining );
+    for( ValueType_T* it = remaining; it != remaining_end; ++it )
+    {
+        if( sel( *it ) )
+            *write_left++ = *it;
+        else
+            *--write_right = *it;
+    }
+
+    partition_store< ValueType_T, Tag_T >( vec_left, sel, write_left, write_right );
+    return partition_store_exact< ValueType_T, Tag_T >( vec_right, sel, write_left );
+}
+
+}} // namespace litesimd::detail
+
+#endif // LITESIMD_ALGORITHM_DETAIL_PARTITION_H
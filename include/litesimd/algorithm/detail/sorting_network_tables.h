@@ -0,0 +1,290 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_DETAIL_SORTING_NETWORK_TABLES_H
+#define LITESIMD_ALGORITHM_DETAIL_SORTING_NETWORK_TABLES_H
+
+#include <cstddef>
+
+namespace litesimd {
+namespace detail {
+
+// Each stage of a network compares the value of each index with the value of its
+// partner index. Indexes set on min_mask keep the lesser value and the other
+// ones keep the greater value. Indexes without comparison are their own partner.
+
+// Bitonic sort, sorts all values of one register
+// ---------------------------------------------------------------------------------------
+template< size_t Size_T > struct bitonic_sort_table;
+
+template<> struct bitonic_sort_table< 2 >
+{
+    constexpr static size_t stages = 1;
+
+    template< typename Index_T >
+    static inline const Index_T* partner( size_t stage )
+    {
+        static const Index_T table[ stages ][ 2 ] = {
+            { 1, 0 }
+        };
+        return table[ stage ];
+    }
+
+    template< typename Index_T >
+    static inline const Index_T* min_mask( size_t stage )
+    {
+        static const Index_T table[ stages ][ 2 ] = {
+            { -1, 0 }
+        };
+        return table[ stage ];
+    }
+};
+
+template<> struct bitonic_sort_table< 4 >
+{
+    constexpr static size_t stages = 3;
+
+    template< typename Index_T >
+    static inline const Index_T* partner( size_t stage )
+    {
+        static const Index_T table[ stages ][ 4 ] = {
+            { 1, 0, 3, 2 },
+            { 2, 3, 0, 1 },
+            { 1, 0, 3, 2 }
+        };
+        return table[ stage ];
+    }
+
+    template< typename Index_T >
+    static inline const Index_T* min_mask( size_t stage )
+    {
+        static const Index_T table[ stages ][ 4 ] = {
+            { -1, 0, 0, -1 },
+            { -1, -1, 0, 0 },
+            { -1, 0, -1, 0 }
+        };
+        return table[ stage ];
+    }
+};
+
+template<> struct bitonic_sort_table< 8 >
+{
+    constexpr static size_t stages = 6;
+
+    template< typename Index_T >
+    static inline const Index_T* partner( size_t stage )
+    {
+        static const Index_T table[ stages ][ 8 ] = {
+            { 1, 0, 3, 2, 5, 4, 7, 6 },
+            { 2, 3, 0, 1, 6, 7, 4, 5 },
+            { 1, 0, 3, 2, 5, 4, 7, 6 },
+            { 4, 5, 6, 7, 0, 1, 2, 3 },
+            { 2, 3, 0, 1, 6, 7, 4, 5 },
+            { 1, 0, 3, 2, 5, 4, 7, 6 }
+        };
+        return table[ stage ];
+    }
+
+    template< typename Index_T >
+    static inline const Index_T* min_mask( size_t stage )
+    {
+        static const Index_T table[ stages ][ 8 ] = {
+            { -1, 0, 0, -1, -1, 0, 0, -1 },
+            { -1, -1, 0, 0, 0, 0, -1, -1 },
+            { -1, 0, -1, 0, 0, -1, 0, -1 },
+            { -1, -1, -1, -1, 0, 0, 0, 0 },
+            { -1, -1, 0, 0, -1, -1, 0, 0 },
+            { -1, 0, -1, 0, -1, 0, -1, 0 }
+        };
+        return table[ stage ];
+    }
+};
+
+// Bitonic merge, sorts one register with a bitonic sequence of values
+// ---------------------------------------------------------------------------------------
+template< size_t Size_T > struct bitonic_merge_table;
+
+template<> struct bitonic_merge_table< 2 >
+{
+    constexpr static size_t stages = 1;
+
+    template< typename Index_T >
+    static inline const Index_T* partner( size_t stage )
+    {
+        static const Index_T table[ stages ][ 2 ] = {
+            { 1, 0 }
+        };
+        return table[ stage ];
+    }
+
+    template< typename Index_T >
+    static inline const Index_T* min_mask( size_t stage )
+    {
+        static const Index_T table[ stages ][ 2 ] = {
+            { -1, 0 }
+        };
+        return table[ stage ];
+    }
+};
+
+template<> struct bitonic_merge_table< 4 >
+{
+    constexpr static size_t stages = 2;
+
+    template< typename Index_T >
+    static inline const Index_T* partner( size_t stage )
+    {
+        static const Index_T table[ stages ][ 4 ] = {
+            { 2, 3, 0, 1 },
+            { 1, 0, 3, 2 }
+        };
+        return table[ stage ];
+    }
+
+    template< typename Index_T >
+    static inline const Index_T* min_mask( size_t stage )
+    {
+        static const Index_T table[ stages ][ 4 ] = {
+            { -1, -1, 0, 0 },
+            { -1, 0, -1, 0 }
+        };
+        return table[ stage ];
+    }
+};
+
+template<> struct bitonic_merge_table< 8 >
+{
+    constexpr static size_t stages = 3;
+
+    template< typename Index_T >
+    static inline const Index_T* partner( size_t stage )
+    {
+        static const Index_T table[ stages ][ 8 ] = {
+            { 4, 5, 6, 7, 0, 1, 2, 3 },
+            { 2, 3, 0, 1, 6, 7, 4, 5 },
+            { 1, 0, 3, 2, 5, 4, 7, 6 }
+        };
+        return table[ stage ];
+    }
+
+    template< typename Index_T >
+    static inline const Index_T* min_mask( size_t stage )
+    {
+        static const Index_T table[ stages ][ 8 ] = {
+            { -1, -1, -1, -1, 0, 0, 0, 0 },
+            { -1, -1, 0, 0, -1, -1, 0, 0 },
+            { -1, 0, -1, 0, -1, 0, -1, 0 }
+        };
+        return table[ stage ];
+    }
+};
+
+// Batcher odd-even merge sort, sorts all values of one register
+// ---------------------------------------------------------------------------------------
+template< size_t Size_T > struct odd_even_sort_table;
+
+template<> struct odd_even_sort_table< 2 >
+{
+    constexpr static size_t stages = 1;
+
+    template< typename Index_T >
+    static inline const Index_T* partner( size_t stage )
+    {
+        static const Index_T table[ stages ][ 2 ] = {
+            { 1, 0 }
+        };
+        return table[ stage ];
+    }
+
+    template< typename Index_T >
+    static inline const Index_T* min_mask( size_t stage )
+    {
+        static const Index_T table[ stages ][ 2 ] = {
+            { -1, 0 }
+        };
+        return table[ stage ];
+    }
+};
+
+template<> struct odd_even_sort_table< 4 >
+{
+    constexpr static size_t stages = 3;
+
+    template< typename Index_T >
+    static inline const Index_T* partner( size_t stage )
+    {
+        static const Index_T table[ stages ][ 4 ] = {
+            { 1, 0, 3, 2 },
+            { 2, 3, 0, 1 },
+            { 0, 2, 1, 3 }
+        };
+        return table[ stage ];
+    }
+
+    template< typename Index_T >
+    static inline const Index_T* min_mask( size_t stage )
+    {
+        static const Index_T table[ stages ][ 4 ] = {
+            { -1, 0, -1, 0 },
+            { -1, -1, 0, 0 },
+            { 0, -1, 0, 0 }
+        };
+        return table[ stage ];
+    }
+};
+
+template<> struct odd_even_sort_table< 8 >
+{
+    constexpr static size_t stages = 6;
+
+    template< typename Index_T >
+    static inline const Index_T* partner( size_t stage )
+    {
+        static const Index_T table[ stages ][ 8 ] = {
+            { 1, 0, 3, 2, 5, 4, 7, 6 },
+            { 2, 3, 0, 1, 6, 7, 4, 5 },
+            { 0, 2, 1, 3, 4, 6, 5, 7 },
+            { 4, 5, 6, 7, 0, 1, 2, 3 },
+            { 0, 1, 4, 5, 2, 3, 6, 7 },
+            { 0, 2, 1, 4, 3, 6, 5, 7 }
+        };
+        return table[ stage ];
+    }
+
+    template< typename Index_T >
+    static inline const Index_T* min_mask( size_t stage )
+    {
+        static const Index_T table[ stages ][ 8 ] = {
+            { -1, 0, -1, 0, -1, 0, -1, 0 },
+            { -1, -1, 0, 0, -1, -1, 0, 0 },
+            { 0, -1, 0, 0, 0, -1, 0, 0 },
+            { -1, -1, -1, -1, 0, 0, 0, 0 },
+            { 0, 0, -1, -1, 0, 0, 0, 0 },
+            { 0, -1, 0, -1, 0, -1, 0, 0 }
+        };
+        return table[ stage ];
+    }
+};
+
+}} // namespace litesimd::detail
+
+#endif // LITESIMD_ALGORITHM_DETAIL_SORTING_NETWORK_TABLES_H
@@ -0,0 +1,350 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_HISTOGRAM_H
+#define LITESIMD_ALGORITHM_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/bitwise.h>
+#include <litesimd/shuffle.h>
+#include <litesimd/arithmetic.h>
+
+namespace litesimd {
+
+namespace detail {
+
+// Number of interleaved sub-histograms, consecutive values are counted on
+// different tables so repeated bins do not wait on the previous increment
+constexpr size_t histogram_tables = 4;
+
+// Largest bin count with the single precision bin at most one bin away from the exact one
+constexpr size_t histogram_max_corrected_bins = size_t( 1 ) << 22;
+
+// Bin of a value inside [lo, hi). Integer ranges that are the bin count times a
+// power of 2 use a shift. Other integer ranges are scaled on single precision and
+// corrected against the first value of each bin, float ranges are only scaled
+template< typename ValueType_T >
+struct histogram_binning
+{
+    histogram_binning( ValueType_T lo, ValueType_T hi, size_t bin_count )
+        : lo_( lo ), hi_( hi ), shift_( -1 ), scale_( 0 ),
+          last_( static_cast< float >( bin_count - 1 ) ), bin_count_( bin_count ), range_( 0 )
+    {
+        double range = static_cast< double >( hi ) - static_cast< double >( lo );
+        if( !(range > 0) )
+            return;
+
+        scale_ = static_cast< float >( static_cast< double >( bin_count ) / range );
+        if( std::is_integral< ValueType_T >::value )
+        {
+            range_ = static_cast< uint64_t >( range );
+            for( int shift = 0; shift < 32 && (static_cast< uint64_t >( bin_count ) << shift) <= range_; ++shift )
+            {
+                if( (static_cast< uint64_t >( bin_count ) << shift) == range_ )
+                    shift_ = shift;
+            }
+
+            // Only the 32 bits SIMD bins are corrected, the others are divided
+            if( sizeof( ValueType_T ) == 4 && shift_ < 0 && range_ <= INT32_MAX &&
+                bin_count <= histogram_max_corrected_bins )
+            {
+                // The entry after the last one is never reached, not even by the out of range values
+                edges_.resize( bin_count + 2 );
+                for( uint64_t i = 0; i <= bin_count; ++i )
+                    edges_[ i ] = (i * range_ + bin_count - 1) / bin_count;
+                edges_[ bin_count + 1 ] = uint64_t( 1 ) << 32;
+            }
+        }
+    }
+
+    bool contains( ValueType_T val ) const
+    {
+        return !(lo_ > val) && hi_ > val;
+    }
+
+    // Only valid for values inside the range
+    int32_t operator()( ValueType_T val ) const
+    {
+        return bin( val, std::is_integral< ValueType_T >() );
+    }
+
+    int32_t bin( ValueType_T val, std::true_type ) const
+    {
+        uint32_t diff = static_cast< uint32_t >( val ) - static_cast< uint32_t >( lo_ );
+        if( shift_ >= 0 )
+            return static_cast< int32_t >( diff >> shift_ );
+        return static_cast< int32_t >( diff * static_cast< uint64_t >( bin_count_ ) / range_ );
+    }
+
+    int32_t bin( ValueType_T val, std::false_type ) const
+    {
+        return clamp( (val - lo_) * scale_ );
+    }
+
+    int32_t clamp( float pos ) const
+    {
+        return static_cast< int32_t >( pos > last_ ? last_ : pos );
+    }
+
+    // Moves the single precision bin of _diff_ to the exact one. The overflow bin,
+    // one past the last, is kept as the out of range values are after its first value
+    int32_t correct( int32_t bin, uint32_t diff ) const
+    {
+        bin -= diff < edges_[ bin ];
+        return bin + (diff >= edges_[ bin + 1 ]);
+    }
+
+    bool corrected() const
+    {
+        return !edges_.empty();
+    }
+
+    // The SIMD bin calculation converts the difference to float as signed int32
+    bool vectorizable() const
+    {
+        return !std::is_integral< ValueType_T >::value || shift_ >= 0 || corrected();
+    }
+
+    ValueType_T lo_;
+    ValueType_T hi_;
+    int shift_;
+    float scale_;
+    float last_;
+    size_t bin_count_;
+    uint64_t range_;
+    std::vector< uint64_t > edges_;
+};
+
+template< typename Tag_T >
+inline simd_type< int32_t, Tag_T >
+histogram_scale( simd_type< float, Tag_T > pos, simd_type< float, Tag_T > scale,
+                 simd_type< float, Tag_T > last )
+{
+    pos = mullo< float, Tag_T >( pos, scale );
+    pos = blend< float, Tag_T >( greater< float, Tag_T >( pos, last ), last, pos );
+    return convert< int32_t >( pos );
+}
+
+template< typename Tag_T >
+inline simd_type< int32_t, Tag_T >
+histogram_bin( simd_type< int32_t, Tag_T > vec, const histogram_binning< int32_t >& binning )
+{
+    using simd = simd_type< int32_t, Tag_T >;
+    using simdf = simd_type< float, Tag_T >;
+
+    simd diff = sub< int32_t, Tag_T >( vec, simd( binning.lo_ ) );
+    if( binning.shift_ >= 0 )
+        return bit_shift_right< int32_t, Tag_T >( diff, binning.shift_ );
+    return histogram_scale< Tag_T >( convert< float >( diff ),
+                                     simdf( binning.scale_ ), simdf( binning.last_ ) );
+}
+
+template< typename Tag_T >
+inline simd_type< int32_t, Tag_T >
+histogram_bin( simd_type< float, Tag_T > vec, const histogram_binning< float >& binning )
+{
+    using simdf = simd_type< float, Tag_T >;
+    return histogram_scale< Tag_T >( sub< float, Tag_T >( vec, simdf( binning.lo_ ) ),
+                                     simdf( binning.scale_ ), simdf( binning.last_ ) );
+}
+
+// 32 bits values: the bins are calculated on SIMD registers, the values out of the
+// range go to an extra bin after the last one
+template< typename Tag_T, typename ValueType_T, typename Count_T >
+inline void histogram( const ValueType_T* first, const ValueType_T* last,
+                       Count_T* bins, size_t bin_count,
+                       ValueType_T lo, ValueType_T hi, std::false_type )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    using simd_index = simd_type< int32_t, Tag_T >;
+    constexpr size_t simd_size = simd::simd_size;
+
+    histogram_binning< ValueType_T > binning( lo, hi, bin_count );
+    if( !binning.vectorizable() )
+    {
+        for( ; first != last; ++first )
+        {
+            if( binning.contains( *first ) )
+                ++bins[ binning( *first ) ];
+        }
+        return;
+    }
+
+    const size_t stride = bin_count + 1;
+    std::vector< Count_T > tables( histogram_tables * stride );
+    Count_T* tab = tables.data();
+
+    simd lo_vec( lo ), hi_vec( hi );
+    simd_index overflow( static_cast< int32_t >( bin_count ) );
+    alignas( simd_index ) int32_t index[ simd_size ];
+    alignas( simd_index ) uint32_t diff[ simd_size ];
+
+    for( ; static_cast< size_t >( last - first ) >= simd_size; first += simd_size )
+    {
+        simd vec = load< ValueType_T, Tag_T >( first );
+        simd inside = bit_and< ValueType_T, Tag_T >( greater< ValueType_T, Tag_T >( hi_vec, vec ),
+                          bit_not< ValueType_T, Tag_T >( greater< ValueType_T, Tag_T >( lo_vec, vec ) ) );
+        simd_index bin = blend< int32_t, Tag_T >( reinterpret< int32_t >( inside ),
+                                                  histogram_bin< Tag_T >( vec, binning ), overflow );
+        store< int32_t, Tag_T >( index, bin );
+        if( binning.corrected() )
+        {
+            store< int32_t, Tag_T >( reinterpret_cast< int32_t* >( diff ),
+                                     reinterpret< int32_t >( sub< ValueType_T, Tag_T >( vec, lo_vec ) ) );
+            for( size_t i = 0; i < simd_size; ++i )
+                index[ i ] = binning.correct( index[ i ], diff[ i ] );
+        }
+
+        for( size_t i = 0; i < simd_size; i += histogram_tables )
+        {
+            ++tab[ index[ i ] ];
+            ++tab[ stride + index[ i + 1 ] ];
+            ++tab[ 2 * stride + index[ i + 2 ] ];
+            ++tab[ 3 * stride + index[ i + 3 ] ];
+        }
+    }
+
+    for( ; first != last; ++first )
+    {
+        if( binning.contains( *first ) )
+            ++tab[ binning( *first ) ];
+    }
+
+    for( size_t i = 0; i < bin_count; ++i )
+        bins[ i ] += tab[ i ] + tab[ stride + i ] + tab[ 2 * stride + i ] + tab[ 3 * stride + i ];
+}
+
+// 8 and 16 bits values: at most 65536 distinct values, each value of the range is
+// counted on its own entry and the bins are summed at the end
+template< typename Tag_T, typename ValueType_T, typename Count_T >
+inline void histogram( const ValueType_T* first, const ValueType_T* last,
+                       Count_T* bins, size_t bin_count,
+                       ValueType_T lo, ValueType_T hi, std::true_type )
+{
+    if( !(hi > lo) )
+        return;
+
+    const uint32_t range = static_cast< uint32_t >( static_cast< int32_t >( hi ) - lo );
+    std::vector< Count_T > tables( 2 * range );
+    Count_T* tab = tables.data();
+
+    for( ; last - first >= 2; first += 2 )
+    {
+        uint32_t diff0 = static_cast< uint32_t >( static_cast< int32_t >( first[ 0 ] ) - lo );
+        uint32_t diff1 = static_cast< uint32_t >( static_cast< int32_t >( first[ 1 ] ) - lo );
+        if( diff0 < range )
+            ++tab[ diff0 ];
+        if( diff1 < range )
+            ++tab[ range + diff1 ];
+    }
+    if( first != last )
+    {
+        uint32_t diff = static_cast< uint32_t >( static_cast< int32_t >( *first ) - lo );
+        if( diff < range )
+            ++tab[ diff ];
+    }
+
+    histogram_binning< ValueType_T > binning( lo, hi, bin_count );
+    for( uint32_t i = 0; i < range; ++i )
+    {
+        bins[ binning( static_cast< ValueType_T >( lo + i ) ) ] += tab[ i ] + tab[ range + i ];
+    }
+}
+
+} // namespace detail
+
+/**
+ * \ingroup algorithm
+ * \brief Counts the values of the range on `bin_count` bins of the same width
+ * covering [lo, hi).
+ *
+ * The bin of each value is `(value - lo) * bin_count / (hi - lo)`. Integer ranges
+ * that are the bin count times a power of 2 are divided by a shift, other
+ * integer ranges are scaled on single precision and moved to the exact bin by
+ * comparing with the first value of the bins around. Float ranges are scaled on
+ * single precision. The values out of [lo, hi) are ignored and the counts are
+ * added to the values already on `bins`.
+ *
+ * For int32_t and float the bins are calculated on SIMD registers and counted
+ * on interleaved sub-histograms, so the same bin on consecutive values does not
+ * stall on the previous increment. For int8_t and int16_t each value is counted
+ * directly and the bins are summed at the end.
+ *
+ * \param first, last Range of values
+ * \param bins Array with `bin_count` counters
+ * \param bin_count Number of bins
+ * \param lo, hi Range of values counted
+ * \tparam ValueType_T Only int8_t, int16_t, int32_t and float are supported
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< float > values = { 0.1f, 0.2f, 0.4f, 0.5f, 0.6f, 0.9f, 1.5f, -1.0f };
+ *     size_t bins[ 4 ] = {};
+ *     ls::histogram( values.data(), values.data() + values.size(), bins, 4, 0.0f, 1.0f );
+ *
+ *     for( auto b : bins )
+ *         std::cout << b << " ";
+ *     std::cout << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * 2 1 2 1
+ * ```
+ */
+template< typename Tag_T = default_tag, typename ValueType_T, typename Count_T >
+inline void histogram( const ValueType_T* first, const ValueType_T* last,
+                       Count_T* bins, size_t bin_count,
+                       typename std::remove_cv< ValueType_T >::type lo,
+                       typename std::remove_cv< ValueType_T >::type hi )
+{
+    static_assert( std::is_same< ValueType_T, int8_t >::value ||
+                   std::is_same< ValueType_T, int16_t >::value ||
+                   std::is_same< ValueType_T, int32_t >::value ||
+                   std::is_same< ValueType_T, float >::value,
+                   "Only int8_t, int16_t, int32_t and float are supported" );
+
+    if( bin_count == 0 || bin_count > INT32_MAX )
+        return;
+
+    detail::histogram< Tag_T >( first, last, bins, bin_count, lo, hi,
+                                std::integral_constant< bool, (sizeof( ValueType_T ) < 4) >() );
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ALGORITHM_HISTOGRAM_H
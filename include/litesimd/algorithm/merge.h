@@ -0,0 +1,289 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_MERGE_H
+#define LITESIMD_ALGORITHM_MERGE_H
+
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/algorithm/sorting_network.h>
+#include <litesimd/algorithm/detail/gallop.h>
+
+namespace litesimd {
+
+namespace detail {
+
+// Empty payload array, used by the merge without payload. All operations are no-ops.
+struct no_payload
+{
+    no_payload operator+( ptrdiff_t ) const { return *this; }
+    no_payload& operator+=( ptrdiff_t ) { return *this; }
+};
+
+template< typename Tag_T, typename Payload_T >
+inline simd_type< Payload_T, Tag_T > merge_load( const Payload_T* ptr )
+{
+    return load< Payload_T, Tag_T >( ptr );
+}
+
+template< typename Tag_T >
+inline no_payload merge_load( no_payload ) { return no_payload(); }
+
+template< typename Tag_T, typename Payload_T >
+inline void merge_store( Payload_T* ptr, simd_type< Payload_T, Tag_T > vec )
+{
+    store< Payload_T, Tag_T >( ptr, vec );
+}
+
+template< typename Tag_T >
+inline void merge_store( no_payload, no_payload ) {}
+
+template< typename ValueType_T, typename Payload_T, typename Tag_T >
+inline void merge_exchange( simd_type< ValueType_T, Tag_T >& a, simd_type< ValueType_T, Tag_T >& b,
+                            simd_type< Payload_T, Tag_T >& pa, simd_type< Payload_T, Tag_T >& pb )
+{
+    bitonic_merge( a, b, pa, pb );
+}
+
+template< typename ValueType_T, typename Tag_T >
+inline void merge_exchange( simd_type< ValueType_T, Tag_T >& a, simd_type< ValueType_T, Tag_T >& b,
+                            no_payload&, no_payload& )
+{
+    bitonic_merge( a, b );
+}
+
+template< typename Payload_T >
+inline void merge_copy_n( const Payload_T* src, ptrdiff_t size, Payload_T* dst )
+{
+    std::copy( src, src + size, dst );
+}
+
+inline void merge_copy_n( no_payload, ptrdiff_t, no_payload ) {}
+
+// Temporary payload buffer for the tail of the merge
+template< typename Payload_T, size_t Size_T >
+struct merge_buffer
+{
+    Payload_T* get() { return data_; }
+    Payload_T data_[ Size_T ];
+};
+
+template< size_t Size_T >
+struct merge_buffer< no_payload, Size_T >
+{
+    no_payload get() { return no_payload(); }
+};
+
+// Size ratio of the runs to merge by galloping
+constexpr ptrdiff_t merge_gallop_ratio = 64;
+
+// Merges a small run into a larger one. The values of the large run lesser than
+// each value of the small run are found with a galloping search and copied in block.
+template< typename ValueType_T, typename PayloadSmall_T, typename PayloadLarge_T, typename PayloadOut_T >
+inline ValueType_T* merge_small_run( const ValueType_T* small, ptrdiff_t small_size, PayloadSmall_T small_payload,
+                                     const ValueType_T* large, ptrdiff_t large_size, PayloadLarge_T large_payload,
+                                     ValueType_T* out, PayloadOut_T out_payload )
+{
+    const ValueType_T* large_last = large + large_size;
+    for( ptrdiff_t i = 0; i < small_size; ++i )
+    {
+        ptrdiff_t run = gallop_lower_bound( large, large_last, small[ i ] ) - large;
+        std::copy( large, large + run, out );
+        merge_copy_n( large_payload, run, out_payload );
+        large += run;
+        large_payload += run;
+        out += run;
+        out_payload += run;
+
+        *out++ = small[ i ];
+        merge_copy_n( small_payload + i, 1, out_payload );
+        out_payload += 1;
+    }
+    merge_copy_n( large_payload, large_last - large, out_payload );
+    return std::copy( large, large_last, out );
+}
+
+template< typename Tag_T, typename ValueType_T, typename PayloadIn_T, typename PayloadOut_T >
+inline ValueType_T* merge( const ValueType_T* a, const ValueType_T* a_last, PayloadIn_T a_payload,
+                           const ValueType_T* b, const ValueType_T* b_last, PayloadIn_T b_payload,
+                           ValueType_T* out, PayloadOut_T out_payload )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    using payload_simd = decltype( merge_load< Tag_T >( a_payload ) );
+    constexpr ptrdiff_t simd_size = simd::simd_size;
+
+    // Very unbalanced runs are faster merged by galloping on the larger one
+    ptrdiff_t a_size = a_last - a;
+    ptrdiff_t b_size = b_last - b;
+    if( a_size < simd_size || a_size * merge_gallop_ratio <= b_size )
+        return merge_small_run( a, a_size, a_payload, b, b_size, b_payload, out, out_payload );
+    if( b_size < simd_size || b_size * merge_gallop_ratio <= a_size )
+        return merge_small_run( b, b_size, b_payload, a, a_size, a_payload, out, out_payload );
+
+    simd lo = load< ValueType_T, Tag_T >( a );
+    simd hi = load< ValueType_T, Tag_T >( b );
+    payload_simd plo = merge_load< Tag_T >( a_payload );
+    payload_simd phi = merge_load< Tag_T >( b_payload );
+    a += simd_size;
+    b += simd_size;
+    a_payload += simd_size;
+    b_payload += simd_size;
+
+    for( ;; )
+    {
+        // _lo_ gets the lowest values, which are lesser than any value not loaded yet
+        merge_exchange( lo, hi, plo, phi );
+        store< ValueType_T, Tag_T >( out, lo );
+        merge_store< Tag_T >( out_payload, plo );
+        out += simd_size;
+        out_payload += simd_size;
+
+        if( a_last - a < simd_size || b_last - b < simd_size )
+            break;
+
+        // Loads the next register from the run with the lowest first value, without branches
+        bool take_a = *a < *b;
+        const ValueType_T* next = take_a ? a : b;
+        PayloadIn_T next_payload = take_a ? a_payload : b_payload;
+        lo = load< ValueType_T, Tag_T >( next );
+        plo = merge_load< Tag_T >( next_payload );
+
+        ptrdiff_t step_a = take_a ? simd_size : 0;
+        a += step_a;
+        a_payload += step_a;
+        b += simd_size - step_a;
+        b_payload += simd_size - step_a;
+    }
+
+    // Less than one register remaining on one of the runs. Merges it with the
+    // highest values, then merges the result with the other run.
+    ValueType_T buffer[ simd_size ];
+    ValueType_T tail[ 2 * simd_size ];
+    using payload_type = typename std::remove_pointer< PayloadOut_T >::type;
+    merge_buffer< payload_type, simd_size > pbuffer;
+    merge_buffer< payload_type, 2 * simd_size > ptail;
+    store< ValueType_T, Tag_T >( buffer, hi );
+    merge_store< Tag_T >( pbuffer.get(), phi );
+
+    if( a_last - a > b_last - b )
+    {
+        std::swap( a, b );
+        std::swap( a_last, b_last );
+        std::swap( a_payload, b_payload );
+    }
+    ValueType_T* tail_last = merge_small_run(
+                                a, a_last - a, a_payload, buffer, simd_size, pbuffer.get(),
+                                tail, ptail.get() );
+    return merge_small_run(
+                tail, tail_last - tail, ptail.get(), b, b_last - b, b_payload, out, out_payload );
+}
+
+} // namespace detail
+
+/**
+ * \ingroup algorithm
+ * \brief Merges two sorted ranges into one sorted range.
+ *
+ * Each step loads one SIMD register from the range with the lowest next value,
+ * chosen without branches, and merges it with the highest values of the previous
+ * step by the bitonic_merge network. The lowest half is stored on the output. When one
+ * of the ranges has less than one register remaining, the merge finishes copying
+ * blocks of the other range. Only 32 and 64 bits values are supported, the output
+ * must not overlap the inputs and the merge is not stable.
+ *
+ * \param a_first, a_last First sorted range
+ * \param b_first, b_last Second sorted range
+ * \param out Beginning of the output range, with room for both ranges
+ * \returns Pointer past the last value written
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > a = { 1, 3, 5, 7, 9, 11 };
+ *     std::vector< int32_t > b = { 2, 4, 6, 8, 10 };
+ *     std::vector< int32_t > out( a.size() + b.size() );
+ *     ls::merge( a.data(), a.data() + a.size(), b.data(), b.data() + b.size(), out.data() );
+ *
+ *     for( auto v : out )
+ *         std::cout << v << " ";
+ *     std::cout << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * 1 2 3 4 5 6 7 8 9 10 11
+ * ```
+ *
+ * \see bitonic_merge, sort
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline ValueType_T* merge( const ValueType_T* a_first, const ValueType_T* a_last,
+                           const ValueType_T* b_first, const ValueType_T* b_last, ValueType_T* out )
+{
+    static_assert( sizeof( ValueType_T ) == 4 || sizeof( ValueType_T ) == 8,
+                   "Only 32 and 64 bits values are supported" );
+    return detail::merge< Tag_T >( a_first, a_last, detail::no_payload(),
+                                   b_first, b_last, detail::no_payload(), out, detail::no_payload() );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Merges two sorted ranges of keys into one sorted range, moving the payload
+ * values along the keys.
+ *
+ * The payload values must have the same size of the keys.
+ *
+ * \param a_first, a_last First sorted range of keys
+ * \param a_payload Payload of the first range
+ * \param b_first, b_last Second sorted range of keys
+ * \param b_payload Payload of the second range
+ * \param out Beginning of the output keys, with room for both ranges
+ * \param out_payload Beginning of the output payload
+ * \returns Pointer past the last key written
+ *
+ * \see merge
+ */
+template< typename Tag_T = default_tag, typename ValueType_T, typename Payload_T >
+inline ValueType_T* merge( const ValueType_T* a_first, const ValueType_T* a_last, const Payload_T* a_payload,
+                           const ValueType_T* b_first, const ValueType_T* b_last, const Payload_T* b_payload,
+                           ValueType_T* out, Payload_T* out_payload )
+{
+    static_assert( sizeof( ValueType_T ) == 4 || sizeof( ValueType_T ) == 8,
+                   "Only 32 and 64 bits values are supported" );
+    static_assert( sizeof( ValueType_T ) == sizeof( Payload_T ), "Keys and payload must have the same size" );
+    return detail::merge< Tag_T >( a_first, a_last, a_payload, b_first, b_last, b_payload, out, out_payload );
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ALGORITHM_MERGE_H
@@ -0,0 +1,133 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_PARTITION_H
+#define LITESIMD_ALGORITHM_PARTITION_H
+
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/algorithm/detail/partition.h>
+
+namespace litesimd {
+
+/**
+ * \ingroup algorithm
+ * \brief Reorders the range with the values lesser than the pivot first.
+ *
+ * Each SIMD register is classified with `greater` and written on both sides of the
+ * range with compress and two stores, without branches on the values. The first and last
+ * registers are kept aside, so the partition is made in place. The partition is
+ * not stable. Only 32 and 64 bits values are supported.
+ *
+ * \param first, last Range of values
+ * \param pivot Values lesser than _pivot_ go to the beginning of the range
+ * \returns Pointer to the first value not lesser than the pivot
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values = { 9, 2, 7, 4, 5, 6, 3, 8, 1, 0 };
+ *     int32_t* mid = ls::partition( values.data(), values.data() + values.size(), 5 );
+ *     std::cout << "lesser than 5: " << mid - values.data() << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * lesser than 5: 5
+ * ```
+ *
+ * \see nth_element, sort
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline ValueType_T* partition( ValueType_T* first, ValueType_T* last,
+                               typename std::remove_cv< ValueType_T >::type pivot )
+{
+    static_assert( sizeof( ValueType_T ) == 4 || sizeof( ValueType_T ) == 8,
+                   "Only 32 and 64 bits values are supported" );
+    return detail::simd_partition< ValueType_T, Tag_T >(
+                first, last, detail::less_than_selector< ValueType_T, Tag_T >( pivot ) );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Reorders the range with the values selected by the predicate first.
+ *
+ * Same of the pivot partition, with the values classified by _simd_pred_, which returns
+ * a SIMD mask. _scalar_pred_ must select the same values, it is used for the values
+ * that don't fill one SIMD register.
+ *
+ * \param first, last Range of values
+ * \param simd_pred SIMD predicate, `simd_type< ValueType_T, Tag_T > simd_pred( simd_type< ValueType_T, Tag_T > )`
+ * \param scalar_pred Scalar predicate, `bool scalar_pred( ValueType_T )`
+ * \returns Pointer to the first value not selected
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ * #include <litesimd/bitwise.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *     using simd = ls::simd_type< int32_t, ls::sse_tag >;
+ *
+ *     // Odd values first
+ *     std::vector< int32_t > values = { 9, 2, 7, 4, 5, 6, 3, 8, 1, 0, 11 };
+ *     int32_t* mid = ls::partition< ls::sse_tag >( values.data(), values.data() + values.size(),
+ *         []( simd v ) { return ls::equal_to( ls::bit_and( v, simd( 1 ) ), simd( 1 ) ); },
+ *         []( int32_t v ) { return (v & 1) == 1; } );
+ *     std::cout << "odd values: " << mid - values.data() << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * odd values: 6
+ * ```
+ *
+ * \see partition
+ */
+template< typename Tag_T = default_tag, typename ValueType_T,
+          typename SimdPredicate_T, typename ScalarPredicate_T >
+inline ValueType_T* partition( ValueType_T* first, ValueType_T* last,
+                               SimdPredicate_T simd_pred, ScalarPredicate_T scalar_pred )
+{
+    static_assert( sizeof( ValueType_T ) == 4 || sizeof( ValueType_T ) == 8,
+                   "Only 32 and 64 bits values are supported" );
+    return detail::simd_partition< ValueType_T, Tag_T >( first, last,
+                detail::predicate_selector< ValueType_T, Tag_T, SimdPredicate_T, ScalarPredicate_T >(
+                    simd_pred, scalar_pred ) );
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ALGORITHM_PARTITION_H
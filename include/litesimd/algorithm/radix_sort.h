@@ -0,0 +1,335 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_RADIX_SORT_H
+#define LITESIMD_ALGORITHM_RADIX_SORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/bitwise.h>
+#include <litesimd/shuffle.h>
+#include <litesimd/algorithm/merge.h>
+
+namespace litesimd {
+
+namespace detail {
+
+template< typename Key_T, int DigitBits_T >
+struct radix_traits
+{
+    static_assert( std::is_same< Key_T, uint32_t >::value || std::is_same< Key_T, uint64_t >::value,
+                   "Only uint32_t and uint64_t keys are supported" );
+    static_assert( DigitBits_T >= 1 && DigitBits_T <= 16, "The digit must have from 1 to 16 bits" );
+
+    // The keys are loaded as signed values of the same size, the shifts are logical
+    using index_type = typename permute_index< Key_T >::type;
+
+    static constexpr size_t radix = size_t( 1 ) << DigitBits_T;
+    static constexpr int passes = (8 * sizeof( Key_T ) + DigitBits_T - 1) / DigitBits_T;
+
+    // Keys on each write combining buffer, one cache line
+    static constexpr size_t buffer_size = 64 / sizeof( Key_T );
+
+    // Keys with the digits extracted at once, smaller on the histogram of narrow digits
+    static constexpr size_t block = 256;
+    static constexpr size_t histogram_block = passes <= 8 ? block : 32;
+};
+
+// Payload of the write combining buffers, empty when sorting only the keys
+template< typename Payload_T >
+struct radix_payload_buffer
+{
+    explicit radix_payload_buffer( size_t size ) : data_( size ) {}
+    Payload_T* get( size_t index ) { return data_.data() + index; }
+    std::vector< Payload_T > data_;
+};
+
+template<>
+struct radix_payload_buffer< no_payload >
+{
+    explicit radix_payload_buffer( size_t ) {}
+    no_payload get( size_t ) { return no_payload(); }
+};
+
+template< typename Payload_T >
+struct radix_payload_storage
+{
+    explicit radix_payload_storage( size_t size ) : data_( size ) {}
+    Payload_T* get() { return data_.data(); }
+    std::vector< Payload_T > data_;
+};
+
+template<>
+struct radix_payload_storage< no_payload >
+{
+    explicit radix_payload_storage( size_t ) {}
+    no_payload get() { return no_payload(); }
+};
+
+// Counts the digits of all passes with one read of the keys. The digits of a block of
+// keys are extracted before being counted, so the counting does not wait on the stores
+template< typename Tag_T, int DigitBits_T, typename Key_T >
+inline void radix_histogram( const Key_T* keys, size_t size, size_t* counts )
+{
+    using traits = radix_traits< Key_T, DigitBits_T >;
+    using index_type = typename traits::index_type;
+    using simd = simd_type< index_type, Tag_T >;
+    constexpr size_t simd_size = simd::simd_size;
+    constexpr size_t radix = traits::radix;
+    constexpr size_t block = traits::histogram_block;
+    constexpr int passes = traits::passes;
+
+    const index_type* values = reinterpret_cast< const index_type* >( keys );
+    simd mask( static_cast< index_type >( radix - 1 ) );
+    alignas( simd ) index_type digit[ passes ][ block ];
+
+    size_t i = 0;
+    for( ; i + block <= size; i += block )
+    {
+        for( size_t k = 0; k < block; k += simd_size )
+        {
+            simd vec = load< index_type, Tag_T >( values + i + k );
+            for( int pass = 0; pass < passes; ++pass )
+            {
+                store< index_type, Tag_T >( digit[ pass ] + k, bit_and< index_type, Tag_T >(
+                    bit_shift_right< index_type, Tag_T >( vec, pass * DigitBits_T ), mask ) );
+            }
+        }
+
+        for( size_t k = 0; k < block; ++k )
+        {
+            for( int pass = 0; pass < passes; ++pass )
+                ++counts[ pass * radix + digit[ pass ][ k ] ];
+        }
+    }
+
+    for( ; i < size; ++i )
+    {
+        for( int pass = 0; pass < passes; ++pass )
+            ++counts[ pass * radix + ((keys[ i ] >> (pass * DigitBits_T)) & (radix - 1)) ];
+    }
+}
+
+// Moves the keys to the position of their digit. The keys of each digit are gathered
+// on a cache line buffer before being copied, so the scattered writes do not touch a
+// different cache line for each key
+template< typename Tag_T, int DigitBits_T, typename Key_T, typename Payload_T >
+inline void radix_scatter( const Key_T* src, Payload_T src_payload, size_t size, int shift,
+                           size_t* offsets, Key_T* dst, Payload_T dst_payload )
+{
+    using traits = radix_traits< Key_T, DigitBits_T >;
+    using index_type = typename traits::index_type;
+    using simd = simd_type< index_type, Tag_T >;
+    using payload_type = typename std::remove_pointer< Payload_T >::type;
+    constexpr size_t simd_size = simd::simd_size;
+    constexpr size_t radix = traits::radix;
+    constexpr size_t buffer_size = traits::buffer_size;
+    constexpr size_t block = traits::block;
+
+    std::vector< Key_T > key_storage( radix * buffer_size );
+    std::vector< uint32_t > fill_storage( radix );
+    radix_payload_buffer< payload_type > payload_buffer( radix * buffer_size );
+    Key_T* key_buffer = key_storage.data();
+    uint32_t* fill = fill_storage.data();
+
+    auto put = [&]( size_t bucket, size_t index )
+    {
+        uint32_t count = fill[ bucket ];
+        size_t slot = bucket * buffer_size + count;
+        key_buffer[ slot ] = src[ index ];
+        merge_copy_n( src_payload + index, 1, payload_buffer.get( slot ) );
+        if( count + 1 == buffer_size )
+        {
+            std::memcpy( dst + offsets[ bucket ], key_buffer + bucket * buffer_size, buffer_size * sizeof( Key_T ) );
+            merge_copy_n( payload_buffer.get( bucket * buffer_size ), buffer_size,
+                          dst_payload + offsets[ bucket ] );
+            offsets[ bucket ] += buffer_size;
+            count = 0;
+        }
+        else
+        {
+            ++count;
+        }
+        fill[ bucket ] = count;
+    };
+
+    const index_type* values = reinterpret_cast< const index_type* >( src );
+    simd mask( static_cast< index_type >( radix - 1 ) );
+    alignas( simd ) index_type digit[ block ];
+
+    size_t i = 0;
+    for( ; i + block <= size; i += block )
+    {
+        for( size_t k = 0; k < block; k += simd_size )
+        {
+            simd vec = load< index_type, Tag_T >( values + i + k );
+            store< index_type, Tag_T >( digit + k, bit_and< index_type, Tag_T >(
+                bit_shift_right< index_type, Tag_T >( vec, shift ), mask ) );
+        }
+
+        for( size_t k = 0; k < block; ++k )
+            put( static_cast< size_t >( digit[ k ] ), i + k );
+    }
+
+    for( ; i < size; ++i )
+        put( static_cast< size_t >( (src[ i ] >> shift) & (radix - 1) ), i );
+
+    for( size_t bucket = 0; bucket < radix; ++bucket )
+    {
+        std::memcpy( dst + offsets[ bucket ], key_buffer + bucket * buffer_size,
+                     fill[ bucket ] * sizeof( Key_T ) );
+        merge_copy_n( payload_buffer.get( bucket * buffer_size ), fill[ bucket ],
+                      dst_payload + offsets[ bucket ] );
+    }
+}
+
+template< typename Tag_T, int DigitBits_T, typename Key_T, typename Payload_T >
+inline void radix_sort( Key_T* keys, size_t size, Payload_T payload )
+{
+    using traits = radix_traits< Key_T, DigitBits_T >;
+    using payload_type = typename std::remove_pointer< Payload_T >::type;
+    constexpr size_t radix = traits::radix;
+
+    if( size < 2 )
+        return;
+
+    std::vector< size_t > counts( traits::passes * radix );
+    radix_histogram< Tag_T, DigitBits_T >( keys, size, counts.data() );
+
+    std::vector< Key_T > key_temp( size );
+    radix_payload_storage< payload_type > payload_temp( size );
+
+    Key_T* src = keys;
+    Key_T* dst = key_temp.data();
+    Payload_T src_payload = payload;
+    Payload_T dst_payload = payload_temp.get();
+
+    for( int pass = 0; pass < traits::passes; ++pass )
+    {
+        size_t* count = counts.data() + pass * radix;
+        int shift = pass * DigitBits_T;
+
+        // All keys with the same digit, nothing to move
+        if( count[ (src[ 0 ] >> shift) & (radix - 1) ] == size )
+            continue;
+
+        size_t offset = 0;
+        for( size_t bucket = 0; bucket < radix; ++bucket )
+        {
+            size_t bucket_size = count[ bucket ];
+            count[ bucket ] = offset;
+            offset += bucket_size;
+        }
+
+        radix_scatter< Tag_T, DigitBits_T >( src, src_payload, size, shift, count, dst, dst_payload );
+        std::swap( src, dst );
+        std::swap( src_payload, dst_payload );
+    }
+
+    if( src != keys )
+    {
+        std::memcpy( keys, src, size * sizeof( Key_T ) );
+        merge_copy_n( src_payload, size, payload );
+    }
+}
+
+} // namespace detail
+
+/**
+ * \ingroup algorithm
+ * \brief Sorts the keys and moves the payload with them, using a least significant
+ * digit radix sort.
+ *
+ * All digits are counted with a single read of the keys and each pass moves the keys
+ * to a temporary array, skipping the digits where all keys are equal. The digits are
+ * extracted on SIMD registers and the scattered keys are gathered on cache line sized
+ * buffers, one for each digit value. The sort is stable: keys with the same value keep
+ * their payload on the original order.
+ *
+ * \param keys Array of keys
+ * \param size Number of keys
+ * \param payload Array with the same size of the keys
+ * \tparam Tag_T Instruction set of the digit extraction
+ * \tparam DigitBits_T Bits of each digit, from 1 to 16. Each pass uses
+ * `2^DigitBits_T` cache lines of buffer
+ * \tparam Key_T Only uint32_t and uint64_t are supported
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< uint32_t > keys = { 3000, 20, 1, 3000, 400000, 20 };
+ *     std::vector< char > names = { 'a', 'b', 'c', 'd', 'e', 'f' };
+ *     ls::radix_sort( keys.data(), keys.size(), names.data() );
+ *
+ *     for( size_t i = 0; i < keys.size(); ++i )
+ *         std::cout << keys[ i ] << names[ i ] << " ";
+ *     std::cout << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * 1c 20b 20f 3000a 3000d 400000e
+ * ```
+ *
+ * \see sort
+ */
+template< typename Tag_T = default_tag, int DigitBits_T = 8, typename Key_T, typename Payload_T >
+inline void radix_sort( Key_T* keys, size_t size, Payload_T* payload )
+{
+    detail::radix_sort< Tag_T, DigitBits_T >( keys, size, payload );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Sorts the keys using a least significant digit radix sort.
+ *
+ * \param keys Array of keys
+ * \param size Number of keys
+ * \tparam Tag_T Instruction set of the digit extraction
+ * \tparam DigitBits_T Bits of each digit, from 1 to 16
+ * \tparam Key_T Only uint32_t and uint64_t are supported
+ *
+ * \see sort
+ */
+template< typename Tag_T = default_tag, int DigitBits_T = 8, typename Key_T >
+inline void radix_sort( Key_T* keys, size_t size )
+{
+    detail::radix_sort< Tag_T, DigitBits_T >( keys, size, detail::no_payload() );
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ALGORITHM_RADIX_SORT_H
@@ -0,0 +1,501 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_REDUCE_H
+#define LITESIMD_ALGORITHM_REDUCE_H
+
+#include <limits>
+#include <utility>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/arithmetic.h>
+#include <litesimd/intravector.h>
+#include <litesimd/detail/arch/sse/algorithm.h>
+#include <litesimd/detail/arch/avx/algorithm.h>
+#include <litesimd/algorithm/minmax.h>
+
+namespace litesimd {
+
+/**
+ * \ingroup algorithm
+ * \brief Summation policy, sums on independent accumulators without any correction.
+ *
+ * This is the fastest policy and the default one.
+ *
+ * \see reduce_sum
+ */
+struct plain_summation {};
+
+/**
+ * \ingroup algorithm
+ * \brief Summation policy, splits the range recursively and sums each half.
+ *
+ * The rounding error grows with the logarithm of the range size instead of the range size.
+ *
+ * \see reduce_sum
+ */
+struct pairwise_summation {};
+
+/**
+ * \ingroup algorithm
+ * \brief Summation policy, Kahan compensated summation on each packed value.
+ *
+ * The rounding error does not depend on the range size, at the cost of 4 operations for
+ * each addition.
+ *
+ * \see reduce_sum
+ */
+struct kahan_summation {};
+
+/**
+ * \ingroup algorithm
+ * \brief Result type of reduce_sum. Integer values are summed on 64 bits.
+ */
+template< typename ValueType_T >
+struct reduce_sum_type
+{
+    using type = typename std::conditional< std::is_integral< ValueType_T >::value,
+                                            int64_t, ValueType_T >::type;
+};
+
+namespace detail {
+
+// How many independent accumulators are used by the reductions
+constexpr size_t reduce_accumulators = 4;
+
+// Ranges smaller than this (in SIMD registers) are not split by the pairwise summation
+constexpr size_t pairwise_block = 32;
+
+template< typename ValueType_T, typename Tag_T >
+struct reduce_add_op
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    inline simd operator()( simd lhs, simd rhs ) { return add< ValueType_T, Tag_T >( lhs, rhs ); }
+};
+
+template< typename ValueType_T >
+inline void kahan_add( ValueType_T& sum, ValueType_T& comp, ValueType_T val )
+{
+    ValueType_T y = val - comp;
+    ValueType_T t = sum + y;
+    comp = (t - sum) - y;
+    sum = t;
+}
+
+// Integer sum, widening each register to 64 bits partial sums. The summation
+// policy does not matter as the integer sum is exact.
+template< typename ValueType_T, typename Tag_T, typename Policy_T >
+inline int64_t reduce_sum( const ValueType_T* first, const ValueType_T* last,
+                           Policy_T, std::true_type )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    using wide = simd_type< int64_t, Tag_T >;
+    constexpr ptrdiff_t size = simd::simd_size;
+    constexpr ptrdiff_t step = size * reduce_accumulators;
+
+    wide acc0 = wide::zero(), acc1 = wide::zero(), acc2 = wide::zero(), acc3 = wide::zero();
+    for( ; last - first >= step; first += step )
+    {
+        acc0 = add< int64_t, Tag_T >( acc0, widen_sum< ValueType_T, Tag_T >(
+                    load< ValueType_T, Tag_T >( first ) ) );
+        acc1 = add< int64_t, Tag_T >( acc1, widen_sum< ValueType_T, Tag_T >(
+                    load< ValueType_T, Tag_T >( first + size ) ) );
+        acc2 = add< int64_t, Tag_T >( acc2, widen_sum< ValueType_T, Tag_T >(
+                    load< ValueType_T, Tag_T >( first + 2 * size ) ) );
+        acc3 = add< int64_t, Tag_T >( acc3, widen_sum< ValueType_T, Tag_T >(
+                    load< ValueType_T, Tag_T >( first + 3 * size ) ) );
+    }
+    for( ; last - first >= size; first += size )
+    {
+        acc0 = add< int64_t, Tag_T >( acc0, widen_sum< ValueType_T, Tag_T >(
+                    load< ValueType_T, Tag_T >( first ) ) );
+    }
+    acc0 = add< int64_t, Tag_T >( add< int64_t, Tag_T >( acc0, acc1 ),
+                                  add< int64_t, Tag_T >( acc2, acc3 ) );
+
+    int64_t sum = horizontal( acc0, reduce_add_op< int64_t, Tag_T >() );
+    for( ; first != last; ++first )
+        sum += *first;
+    return sum;
+}
+
+// Floating point sum, independent accumulators
+template< typename ValueType_T, typename Tag_T >
+inline ValueType_T reduce_sum( const ValueType_T* first, const ValueType_T* last,
+                               plain_summation, std::false_type )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    constexpr ptrdiff_t size = simd::simd_size;
+    constexpr ptrdiff_t step = size * reduce_accumulators;
+
+    simd acc0 = simd::zero(), acc1 = simd::zero(), acc2 = simd::zero(), acc3 = simd::zero();
+    for( ; last - first >= step; first += step )
+    {
+        acc0 = add< ValueType_T, Tag_T >( acc0, load< ValueType_T, Tag_T >( first ) );
+        acc1 = add< ValueType_T, Tag_T >( acc1, load< ValueType_T, Tag_T >( first + size ) );
+        acc2 = add< ValueType_T, Tag_T >( acc2, load< ValueType_T, Tag_T >( first + 2 * size ) );
+        acc3 = add< ValueType_T, Tag_T >( acc3, load< ValueType_T, Tag_T >( first + 3 * size ) );
+    }
+    for( ; last - first >= size; first += size )
+    {
+        acc0 = add< ValueType_T, Tag_T >( acc0, load< ValueType_T, Tag_T >( first ) );
+    }
+    acc0 = add< ValueType_T, Tag_T >( add< ValueType_T, Tag_T >( acc0, acc1 ),
+                                      add< ValueType_T, Tag_T >( acc2, acc3 ) );
+
+    ValueType_T sum = horizontal( acc0, reduce_add_op< ValueType_T, Tag_T >() );
+    for( ; first != last; ++first )
+        sum += *first;
+    return sum;
+}
+
+// Floating point sum, recursive halves down to a block of pairwise_block registers
+template< typename ValueType_T, typename Tag_T >
+inline ValueType_T reduce_sum( const ValueType_T* first, const ValueType_T* last,
+                               pairwise_summation, std::false_type )
+{
+    constexpr ptrdiff_t step = simd_type< ValueType_T, Tag_T >::simd_size * reduce_accumulators;
+    constexpr ptrdiff_t block = step * pairwise_block;
+
+    if( last - first <= block )
+        return reduce_sum< ValueType_T, Tag_T >( first, last, plain_summation(), std::false_type() );
+
+    // Keep the first half multiple of the unrolled step
+    const ValueType_T* middle = first + ((last - first) / 2 / step) * step;
+    return reduce_sum< ValueType_T, Tag_T >( first, middle, pairwise_summation(), std::false_type() )
+         + reduce_sum< ValueType_T, Tag_T >( middle, last, pairwise_summation(), std::false_type() );
+}
+
+// Floating point sum, Kahan compensated on each packed value
+template< typename ValueType_T, typename Tag_T >
+inline ValueType_T reduce_sum( const ValueType_T* first, const ValueType_T* last,
+                               kahan_summation, std::false_type )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    constexpr ptrdiff_t size = simd::simd_size;
+    constexpr ptrdiff_t step = size * reduce_accumulators;
+
+    simd sum[ reduce_accumulators ], comp[ reduce_accumulators ];
+    for( size_t i = 0; i < reduce_accumulators; ++i )
+    {
+        sum[ i ] = simd::zero();
+        comp[ i ] = simd::zero();
+    }
+
+    for( ; last - first >= step; first += step )
+    {
+        for( size_t i = 0; i < reduce_accumulators; ++i )
+        {
+            simd y = sub< ValueType_T, Tag_T >( load< ValueType_T, Tag_T >( first + i * size ), comp[ i ] );
+            simd t = add< ValueType_T, Tag_T >( sum[ i ], y );
+            comp[ i ] = sub< ValueType_T, Tag_T >( sub< ValueType_T, Tag_T >( t, sum[ i ] ), y );
+            sum[ i ] = t;
+        }
+    }
+
+    // Compensated sum of the partial sums and the remaining values
+    ValueType_T total = 0, total_comp = 0;
+    ValueType_T lanes[ size ];
+    for( size_t i = 0; i < reduce_accumulators; ++i )
+    {
+        store< ValueType_T, Tag_T >( lanes, sum[ i ] );
+        for( ptrdiff_t j = 0; j < size; ++j )
+            kahan_add( total, total_comp, lanes[ j ] );
+
+        store< ValueType_T, Tag_T >( lanes, comp[ i ] );
+        for( ptrdiff_t j = 0; j < size; ++j )
+            kahan_add( total, total_comp, -lanes[ j ] );
+    }
+    for( ; first != last; ++first )
+        kahan_add( total, total_comp, *first );
+
+    return total;
+}
+
+template< typename ValueType_T, typename Tag_T >
+struct reduce_min_op
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    static inline ValueType_T identity() { return std::numeric_limits< ValueType_T >::max(); }
+    static inline ValueType_T scalar( ValueType_T lhs, ValueType_T rhs ) { return rhs < lhs ? rhs : lhs; }
+    inline simd operator()( simd lhs, simd rhs ) { return min< ValueType_T, Tag_T >( lhs, rhs ); }
+};
+
+template< typename ValueType_T, typename Tag_T >
+struct reduce_max_op
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    static inline ValueType_T identity() { return std::numeric_limits< ValueType_T >::lowest(); }
+    static inline ValueType_T scalar( ValueType_T lhs, ValueType_T rhs ) { return lhs < rhs ? rhs : lhs; }
+    inline simd operator()( simd lhs, simd rhs ) { return max< ValueType_T, Tag_T >( lhs, rhs ); }
+};
+
+template< typename ValueType_T, typename Tag_T, typename Op_T >
+inline ValueType_T reduce_minmax( const ValueType_T* first, const ValueType_T* last, Op_T op )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    constexpr ptrdiff_t size = simd::simd_size;
+    constexpr ptrdiff_t step = size * reduce_accumulators;
+
+    simd acc0( Op_T::identity() );
+    simd acc1 = acc0, acc2 = acc0, acc3 = acc0;
+    for( ; last - first >= step; first += step )
+    {
+        acc0 = op( acc0, load< ValueType_T, Tag_T >( first ) );
+        acc1 = op( acc1, load< ValueType_T, Tag_T >( first + size ) );
+        acc2 = op( acc2, load< ValueType_T, Tag_T >( first + 2 * size ) );
+        acc3 = op( acc3, load< ValueType_T, Tag_T >( first + 3 * size ) );
+    }
+    for( ; last - first >= size; first += size )
+    {
+        acc0 = op( acc0, load< ValueType_T, Tag_T >( first ) );
+    }
+    acc0 = op( op( acc0, acc1 ), op( acc2, acc3 ) );
+
+    ValueType_T ret = horizontal( acc0, op );
+    for( ; first != last; ++first )
+        ret = Op_T::scalar( ret, *first );
+    return ret;
+}
+
+} // namespace detail
+
+/**
+ * \ingroup algorithm
+ * \brief Returns the sum of all values on the range [first, last).
+ *
+ * The range is summed on 4 independent SIMD accumulators to hide the latency
+ * of the additions. Integer values are summed on 64 bits accumulators, so the
+ * sum does not overflow. Floating point values are summed on its own type and
+ * the _policy_ selects how the rounding error is handled.
+ *
+ * \param first, last Range of values to sum
+ * \param policy One of plain_summation (default), pairwise_summation or kahan_summation.
+ *               Ignored for integer values.
+ * \tparam ValueType_T Type of values on the range
+ * \tparam Tag_T Metaprogramming tag for instruction set selection.
+ * \returns Sum of all values on the range, zero for an empty range
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int8_t > bytes( 1000, 100 );
+ *     std::vector< float > values( 1000, 0.1f );
+ *
+ *     std::cout << "sum( bytes ): "
+ *               << ls::reduce_sum( bytes.data(), bytes.data() + bytes.size() ) << std::endl;
+ *     std::cout << "sum( values ): "
+ *               << ls::reduce_sum( values.data(), values.data() + values.size(),
+ *                                  ls::kahan_summation() ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * sum( bytes ): 100000
+ * sum( values ): 100
+ * ```
+ *
+ * \see reduce_min, reduce_max, reduce_minmax, widen_sum
+ */
+template< typename ValueType_T, typename Tag_T = default_tag, typename Policy_T = plain_summation >
+inline typename reduce_sum_type< ValueType_T >::type
+reduce_sum( const ValueType_T* first, const ValueType_T* last, Policy_T policy = Policy_T() )
+{
+    return detail::reduce_sum< ValueType_T, Tag_T >( first, last, policy,
+                                                     std::is_integral< ValueType_T >() );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Returns the smallest value on the range [first, last).
+ *
+ * \param first, last Range of values to compare
+ * \tparam ValueType_T Type of values on the range
+ * \tparam Tag_T Metaprogramming tag for instruction set selection.
+ * \returns The smallest value, or `std::numeric_limits< ValueType_T >::max()` for an empty range
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values = { 5, 3, 9, -2, 7, 1, 8, 4, 6 };
+ *     std::cout << "min: " << ls::reduce_min( values.data(), values.data() + values.size() )
+ *               << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * min: -2
+ * ```
+ *
+ * \see reduce_max, reduce_minmax
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline ValueType_T reduce_min( const ValueType_T* first, const ValueType_T* last )
+{
+    return detail::reduce_minmax< ValueType_T, Tag_T >( first, last,
+                                    detail::reduce_min_op< ValueType_T, Tag_T >() );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Returns the largest value on the range [first, last).
+ *
+ * \param first, last Range of values to compare
+ * \tparam ValueType_T Type of values on the range
+ * \tparam Tag_T Metaprogramming tag for instruction set selection.
+ * \returns The largest value, or `std::numeric_limits< ValueType_T >::lowest()` for an empty range
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values = { 5, 3, 9, -2, 7, 1, 8, 4, 6 };
+ *     std::cout << "max: " << ls::reduce_max( values.data(), values.data() + values.size() )
+ *               << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * max: 9
+ * ```
+ *
+ * \see reduce_min, reduce_minmax
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline ValueType_T reduce_max( const ValueType_T* first, const ValueType_T* last )
+{
+    return detail::reduce_minmax< ValueType_T, Tag_T >( first, last,
+                                    detail::reduce_max_op< ValueType_T, Tag_T >() );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Returns the smallest and the largest values on the range [first, last).
+ *
+ * Both values are found on a single pass over the range, with 4 independent
+ * accumulators for each of min and max.
+ *
+ * \param first, last Range of values to compare
+ * \tparam ValueType_T Type of values on the range
+ * \tparam Tag_T Metaprogramming tag for instruction set selection.
+ * \returns A pair with the smallest and the largest values. For an empty range the
+ *          pair is `std::numeric_limits< ValueType_T >::max()` and `lowest()`
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values = { 5, 3, 9, -2, 7, 1, 8, 4, 6 };
+ *     auto ret = ls::reduce_minmax( values.data(), values.data() + values.size() );
+ *     std::cout << "min: " << ret.first << ", max: " << ret.second << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * min: -2, max: 9
+ * ```
+ *
+ * \see reduce_min, reduce_max
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline std::pair< ValueType_T, ValueType_T >
+reduce_minmax( const ValueType_T* first, const ValueType_T* last )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    using min_op = detail::reduce_min_op< ValueType_T, Tag_T >;
+    using max_op = detail::reduce_max_op< ValueType_T, Tag_T >;
+    constexpr ptrdiff_t size = simd::simd_size;
+    constexpr ptrdiff_t step = size * detail::reduce_accumulators;
+
+    simd min0( min_op::identity() ), max0( max_op::identity() );
+    simd min1 = min0, min2 = min0, min3 = min0;
+    simd max1 = max0, max2 = max0, max3 = max0;
+    for( ; last - first >= step; first += step )
+    {
+        simd v0 = load< ValueType_T, Tag_T >( first );
+        simd v1 = load< ValueType_T, Tag_T >( first + size );
+        simd v2 = load< ValueType_T, Tag_T >( first + 2 * size );
+        simd v3 = load< ValueType_T, Tag_T >( first + 3 * size );
+        min0 = min< ValueType_T, Tag_T >( min0, v0 );
+        min1 = min< ValueType_T, Tag_T >( min1, v1 );
+        min2 = min< ValueType_T, Tag_T >( min2, v2 );
+        min3 = min< ValueType_T, Tag_T >( min3, v3 );
+        max0 = max< ValueType_T, Tag_T >( max0, v0 );
+        max1 = max< ValueType_T, Tag_T >( max1, v1 );
+        max2 = max< ValueType_T, Tag_T >( max2, v2 );
+        max3 = max< ValueType_T, Tag_T >( max3, v3 );
+    }
+    for( ; last - first >= size; first += size )
+    {
+        simd v0 = load< ValueType_T, Tag_T >( first );
+        min0 = min< ValueType_T, Tag_T >( min0, v0 );
+        max0 = max< ValueType_T, Tag_T >( max0, v0 );
+    }
+    min0 = min< ValueType_T, Tag_T >( min< ValueType_T, Tag_T >( min0, min1 ),
+                                      min< ValueType_T, Tag_T >( min2, min3 ) );
+    max0 = max< ValueType_T, Tag_T >( max< ValueType_T, Tag_T >( max0, max1 ),
+                                      max< ValueType_T, Tag_T >( max2, max3 ) );
+
+    std::pair< ValueType_T, ValueType_T > ret( horizontal( min0, min_op() ),
+                                               horizontal( max0, max_op() ) );
+    for( ; first != last; ++first )
+    {
+        ret.first = min_op::scalar( ret.first, *first );
+        ret.second = max_op::scalar( ret.second, *first );
+    }
+    return ret;
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ALGORITHM_REDUCE_H
@@ -0,0 +1,502 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_SET_OPERATIONS_H
+#define LITESIMD_ALGORITHM_SET_OPERATIONS_H
+
+#include <cstddef>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/bitwise.h>
+#include <litesimd/shuffle.h>
+#include <litesimd/algorithm/sorting_network.h>
+#include <litesimd/algorithm/detail/gallop.h>
+#include <litesimd/algorithm/detail/compress_output.h>
+
+namespace litesimd {
+
+namespace detail {
+
+// Size ratio of the sets to use the galloping search on the larger one
+constexpr ptrdiff_t set_gallop_ratio = 32;
+
+// Integer type used on the SIMD registers, the comparisons for equality don't
+// depend on the signedness
+template< typename ValueType_T >
+struct set_index
+{
+    static_assert( std::is_integral< ValueType_T >::value &&
+                   (sizeof( ValueType_T ) == 4 || sizeof( ValueType_T ) == 8),
+                   "Only 32 and 64 bits integers are supported" );
+    using type = typename permute_index< ValueType_T >::type;
+};
+
+template< typename Tag_T, typename ValueType_T >
+inline simd_type< typename set_index< ValueType_T >::type, Tag_T > set_load( const ValueType_T* ptr )
+{
+    using index_type = typename set_index< ValueType_T >::type;
+    return load< index_type, Tag_T >( reinterpret_cast< const index_type* >( ptr ) );
+}
+
+// Rotations of the SIMD register, used to compare all pairs of values of two registers
+template< typename Index_T, typename Tag_T >
+struct set_rotations
+{
+    using simd = simd_type< Index_T, Tag_T >;
+    constexpr static size_t simd_size = simd::simd_size;
+
+    set_rotations()
+    {
+        Index_T index[ simd_size ];
+        for( size_t k = 0; k < simd_size; ++k )
+        {
+            for( size_t i = 0; i < simd_size; ++i )
+                index[ i ] = static_cast< Index_T >( (i + k) % simd_size );
+            rotate_[ k ] = load< Index_T, Tag_T >( index );
+        }
+    }
+
+    // Mask of the values of _a_ found on _b_
+    inline simd match( simd a, simd b ) const
+    {
+        simd mask = equal_to< Index_T, Tag_T >( a, b );
+        for( size_t k = 1; k < simd_size; ++k )
+            mask = bit_or< Index_T, Tag_T >( mask, equal_to< Index_T, Tag_T >( a, permute( b, rotate_[ k ] ) ) );
+        return mask;
+    }
+
+    simd rotate_[ simd_size ];
+};
+
+// Intersection
+// ---------------------------------------------------------------------------------------
+template< typename ValueType_T, typename Output_T >
+inline void set_intersection_gallop( const ValueType_T* small, const ValueType_T* small_last,
+                                     const ValueType_T* large, const ValueType_T* large_last, Output_T& out )
+{
+    for( ; small != small_last && large != large_last; ++small )
+    {
+        large = gallop_lower_bound( large, large_last, *small );
+        if( large != large_last && *large == *small )
+        {
+            out.put( *small );
+            ++large;
+        }
+    }
+}
+
+template< typename Tag_T, typename ValueType_T, typename Output_T >
+inline void set_intersection( const ValueType_T* a, const ValueType_T* a_last,
+                              const ValueType_T* b, const ValueType_T* b_last, Output_T& out )
+{
+    using index_type = typename set_index< ValueType_T >::type;
+    constexpr ptrdiff_t simd_size = simd_type< index_type, Tag_T >::simd_size;
+
+    if( (a_last - a) * set_gallop_ratio <= b_last - b )
+        return set_intersection_gallop( a, a_last, b, b_last, out );
+    if( (b_last - b) * set_gallop_ratio <= a_last - a )
+        return set_intersection_gallop( b, b_last, a, a_last, out );
+
+    const set_rotations< index_type, Tag_T > rotations;
+    while( a_last - a >= simd_size && b_last - b >= simd_size )
+    {
+        simd_type< index_type, Tag_T > va = set_load< Tag_T >( a );
+        out.put( rotations.match( va, set_load< Tag_T >( b ) ), va );
+
+        // Advances the register with the lowest last value, or both when equal
+        ValueType_T a_max = a[ simd_size - 1 ];
+        ValueType_T b_max = b[ simd_size - 1 ];
+        a += (a_max <= b_max) ? simd_size : 0;
+        b += (b_max <= a_max) ? simd_size : 0;
+    }
+
+    while( a != a_last && b != b_last )
+    {
+        if( *a < *b )
+            ++a;
+        else if( *b < *a )
+            ++b;
+        else
+        {
+            out.put( *a );
+            ++a;
+            ++b;
+        }
+    }
+}
+
+// Difference
+// ---------------------------------------------------------------------------------------
+template< typename ValueType_T, typename Output_T >
+inline void set_difference_gallop( const ValueType_T* a, const ValueType_T* a_last,
+                                   const ValueType_T* b, const ValueType_T* b_last, Output_T& out,
+                                   uint32_t skip = 0 )
+{
+    // Galloping on _b_, the values of _a_ with the _skip_ bit set were already found
+    for( ; a != a_last && b != b_last; ++a, skip >>= 1 )
+    {
+        if( skip & 1 )
+            continue;
+        b = gallop_lower_bound( b, b_last, *a );
+        if( b == b_last || *b != *a )
+            out.put( *a );
+    }
+    for( ; a != a_last; ++a, skip >>= 1 )
+        if( !(skip & 1) )
+            out.put( *a );
+}
+
+template< typename ValueType_T, typename Output_T >
+inline void set_difference_copy( const ValueType_T* a, const ValueType_T* a_last,
+                                 const ValueType_T* b, const ValueType_T* b_last, Output_T& out )
+{
+    // Galloping on _a_, the values between the values of _b_ are copied in block
+    for( ; b != b_last && a != a_last; ++b )
+    {
+        const ValueType_T* run = gallop_lower_bound( a, a_last, *b );
+        out.put( a, run );
+        a = run;
+        if( a != a_last && *a == *b )
+            ++a;
+    }
+    out.put( a, a_last );
+}
+
+template< typename Tag_T, typename ValueType_T, typename Output_T >
+inline void set_difference( const ValueType_T* a, const ValueType_T* a_last,
+                            const ValueType_T* b, const ValueType_T* b_last, Output_T& out )
+{
+    using index_type = typename set_index< ValueType_T >::type;
+    using simd = simd_type< index_type, Tag_T >;
+    constexpr ptrdiff_t simd_size = simd::simd_size;
+
+    if( (a_last - a) * set_gallop_ratio <= b_last - b )
+        return set_difference_gallop( a, a_last, b, b_last, out );
+    if( (b_last - b) * set_gallop_ratio <= a_last - a )
+        return set_difference_copy( a, a_last, b, b_last, out );
+
+    // Values of the current register of _a_ found on any register of _b_
+    const set_rotations< index_type, Tag_T > rotations;
+    simd found = simd::zero();
+    while( a_last - a >= simd_size && b_last - b >= simd_size )
+    {
+        simd va = set_load< Tag_T >( a );
+        found = bit_or< index_type, Tag_T >( found, rotations.match( va, set_load< Tag_T >( b ) ) );
+
+        // When _a_ advances, the values not found are written, without branches
+        ValueType_T a_max = a[ simd_size - 1 ];
+        ValueType_T b_max = b[ simd_size - 1 ];
+        bool next_a = a_max <= b_max;
+        simd done( static_cast< index_type >( -static_cast< index_type >( next_a ) ) );
+        out.put( bit_and< index_type, Tag_T >( done, bit_not< index_type, Tag_T >( found ) ), va );
+        found = bit_and< index_type, Tag_T >( found, bit_not< index_type, Tag_T >( done ) );
+
+        a += next_a ? simd_size : 0;
+        b += (b_max <= a_max) ? simd_size : 0;
+    }
+
+    set_difference_gallop( a, a_last, b, b_last, out,
+                           mask_to_lane_bitmask< index_type, Tag_T >( found ) );
+}
+
+// Union
+// ---------------------------------------------------------------------------------------
+// Union of a small set into a larger one. The values of the large set between the
+// values of the small set are copied in block. The small set may have repeated
+// values and the values equal to the last value written are skipped.
+template< typename ValueType_T, typename Output_T >
+inline void set_union_gallop( const ValueType_T* small, const ValueType_T* small_last,
+                              const ValueType_T* large, const ValueType_T* large_last, Output_T& out,
+                              bool has_last = false, ValueType_T last = ValueType_T() )
+{
+    for( ; small != small_last; ++small )
+    {
+        if( has_last && large != large_last && *large == last )
+            ++large;
+
+        const ValueType_T* run = gallop_lower_bound( large, large_last, *small );
+        if( run != large )
+        {
+            out.put( large, run );
+            last = run[ -1 ];
+            has_last = true;
+        }
+        large = run;
+        if( large != large_last && *large == *small )
+            ++large;
+
+        if( !has_last || *small != last )
+        {
+            out.put( *small );
+            last = *small;
+            has_last = true;
+        }
+    }
+    if( has_last && large != large_last && *large == last )
+        ++large;
+    out.put( large, large_last );
+}
+
+// Bias to keep the order of unsigned values on the signed SIMD comparisons
+template< typename ValueType_T, typename Index_T >
+inline Index_T set_order_bias()
+{
+    return std::is_signed< ValueType_T >::value ? Index_T( 0 ) : std::numeric_limits< Index_T >::min();
+}
+
+template< typename Tag_T, typename ValueType_T, typename Output_T >
+inline void set_union( const ValueType_T* a, const ValueType_T* a_last,
+                       const ValueType_T* b, const ValueType_T* b_last, Output_T& out )
+{
+    using index_type = typename set_index< ValueType_T >::type;
+    using simd = simd_type< index_type, Tag_T >;
+    constexpr ptrdiff_t simd_size = simd::simd_size;
+
+    ptrdiff_t a_size = a_last - a;
+    ptrdiff_t b_size = b_last - b;
+    if( a_size < simd_size || a_size * set_gallop_ratio <= b_size )
+        return set_union_gallop( a, a_last, b, b_last, out );
+    if( b_size < simd_size || b_size * set_gallop_ratio <= a_size )
+        return set_union_gallop( b, b_last, a, a_last, out );
+
+    // Same as merge, removing the values equal to the previous one
+    const simd bias( set_order_bias< ValueType_T, index_type >() );
+    simd lo = bit_xor< index_type, Tag_T >( set_load< Tag_T >( a ), bias );
+    simd hi = bit_xor< index_type, Tag_T >( set_load< Tag_T >( b ), bias );
+    a += simd_size;
+    b += simd_size;
+
+    // Differs from the first merged value, the lowest of both sets
+    index_type prev = std::min( get< 0 >( lo ), get< 0 >( hi ) ) ^ 1;
+    for( ;; )
+    {
+        bitonic_merge( lo, hi );
+        simd repeated = equal_to< index_type, Tag_T >( lo, low_insert< index_type, Tag_T >( lo, prev ) );
+        out.put( bit_not< index_type, Tag_T >( repeated ), bit_xor< index_type, Tag_T >( lo, bias ) );
+        prev = get< simd_size - 1 >( lo );
+
+        if( a_last - a < simd_size || b_last - b < simd_size )
+            break;
+
+        bool take_a = *a < *b;
+        lo = bit_xor< index_type, Tag_T >( set_load< Tag_T >( take_a ? a : b ), bias );
+        ptrdiff_t step_a = take_a ? simd_size : 0;
+        a += step_a;
+        b += simd_size - step_a;
+    }
+
+    // Merges the highest values with the shortest tail, then makes the union with the other one
+    ValueType_T buffer[ simd_size ];
+    ValueType_T tail[ 2 * simd_size ];
+    store< index_type, Tag_T >( reinterpret_cast< index_type* >( buffer ),
+                                bit_xor< index_type, Tag_T >( hi, bias ) );
+    if( a_last - a > b_last - b )
+    {
+        std::swap( a, b );
+        std::swap( a_last, b_last );
+    }
+    ValueType_T* tail_last = std::merge( a, a_last, buffer, buffer + simd_size, tail );
+
+    index_type last = prev ^ get< 0 >( bias );
+    set_union_gallop( static_cast< const ValueType_T* >( tail ), static_cast< const ValueType_T* >( tail_last ),
+                      b, b_last, out, true, static_cast< ValueType_T >( last ) );
+}
+
+} // namespace detail
+
+/**
+ * \ingroup algorithm
+ * \brief Intersection of two sorted sets.
+ *
+ * Each step compares all pairs of values of one SIMD register of each set, with
+ * the registers rotated by permute, and writes the values found with compress.
+ * The register with the lowest last value is advanced, or both when they are equal.
+ * When one of the sets is much smaller than the other, the values of the small set
+ * are searched on the large one with a galloping search.
+ *
+ * The sets must be sorted and without repeated values. Only 32 and 64 bits
+ * integers are supported, like `uint32_t` document ids.
+ *
+ * \param a_first, a_last First sorted set
+ * \param b_first, b_last Second sorted set
+ * \param out Beginning of the output, with room for the values of the smallest set
+ * \returns Pointer past the last value written
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< uint32_t > a = { 1, 3, 4, 7, 9, 12, 15 };
+ *     std::vector< uint32_t > b = { 2, 3, 7, 8, 12, 13 };
+ *     std::vector< uint32_t > out( std::min( a.size(), b.size() ) );
+ *     out.resize( ls::set_intersection( a.data(), a.data() + a.size(),
+ *                                       b.data(), b.data() + b.size(), out.data() ) - out.data() );
+ *
+ *     for( auto v : out )
+ *         std::cout << v << " ";
+ *     std::cout << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * 3 7 12
+ * ```
+ *
+ * \see set_intersection_count, set_union, set_difference
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline ValueType_T* set_intersection( const ValueType_T* a_first, const ValueType_T* a_last,
+                                      const ValueType_T* b_first, const ValueType_T* b_last,
+                                      ValueType_T* out )
+{
+    detail::compress_output< ValueType_T > output( out, out + std::min( a_last - a_first, b_last - b_first ) );
+    detail::set_intersection< Tag_T >( a_first, a_last, b_first, b_last, output );
+    return output.result();
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Number of values on the intersection of two sorted sets, without writing them.
+ *
+ * \param a_first, a_last First sorted set
+ * \param b_first, b_last Second sorted set
+ * \returns Number of values on both sets
+ *
+ * \see set_intersection
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline size_t set_intersection_count( const ValueType_T* a_first, const ValueType_T* a_last,
+                                      const ValueType_T* b_first, const ValueType_T* b_last )
+{
+    detail::compress_counter< ValueType_T > counter;
+    detail::set_intersection< Tag_T >( a_first, a_last, b_first, b_last, counter );
+    return counter.result();
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Union of two sorted sets.
+ *
+ * The sets are merged like merge, and the values equal to the previous value are
+ * removed with compress. When one of the sets is much smaller than the other, the
+ * values of the large set between the values of the small one are copied in block.
+ *
+ * The sets must be sorted and without repeated values. Only 32 and 64 bits
+ * integers are supported.
+ *
+ * \param a_first, a_last First sorted set
+ * \param b_first, b_last Second sorted set
+ * \param out Beginning of the output, with room for the values of both sets
+ * \returns Pointer past the last value written
+ *
+ * \see set_union_count, set_intersection, merge
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline ValueType_T* set_union( const ValueType_T* a_first, const ValueType_T* a_last,
+                               const ValueType_T* b_first, const ValueType_T* b_last,
+                               ValueType_T* out )
+{
+    detail::compress_output< ValueType_T > output( out, out + (a_last - a_first) + (b_last - b_first) );
+    detail::set_union< Tag_T >( a_first, a_last, b_first, b_last, output );
+    return output.result();
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Number of values on the union of two sorted sets, without writing them.
+ *
+ * \param a_first, a_last First sorted set
+ * \param b_first, b_last Second sorted set
+ * \returns Number of values on any of the sets
+ *
+ * \see set_union
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline size_t set_union_count( const ValueType_T* a_first, const ValueType_T* a_last,
+                               const ValueType_T* b_first, const ValueType_T* b_last )
+{
+    detail::compress_counter< ValueType_T > counter;
+    detail::set_union< Tag_T >( a_first, a_last, b_first, b_last, counter );
+    return counter.result();
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Values of the first sorted set not found on the second one.
+ *
+ * Uses the same all pairs comparison of set_intersection, accumulating the values
+ * found on each register of the first set until it is advanced.
+ *
+ * The sets must be sorted and without repeated values. Only 32 and 64 bits
+ * integers are supported.
+ *
+ * \param a_first, a_last First sorted set
+ * \param b_first, b_last Second sorted set
+ * \param out Beginning of the output, with room for the values of the first set
+ * \returns Pointer past the last value written
+ *
+ * \see set_difference_count, set_intersection
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline ValueType_T* set_difference( const ValueType_T* a_first, const ValueType_T* a_last,
+                                    const ValueType_T* b_first, const ValueType_T* b_last,
+                                    ValueType_T* out )
+{
+    detail::compress_output< ValueType_T > output( out, out + (a_last - a_first) );
+    detail::set_difference< Tag_T >( a_first, a_last, b_first, b_last, output );
+    return output.result();
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Number of values of the first sorted set not found on the second one,
+ * without writing them.
+ *
+ * \param a_first, a_last First sorted set
+ * \param b_first, b_last Second sorted set
+ * \returns Number of values only on the first set
+ *
+ * \see set_difference
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline size_t set_difference_count( const ValueType_T* a_first, const ValueType_T* a_last,
+                                    const ValueType_T* b_first, const ValueType_T* b_last )
+{
+    detail::compress_counter< ValueType_T > counter;
+    detail::set_difference< Tag_T >( a_first, a_last, b_first, b_last, counter );
+    return counter.result();
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ALGORITHM_SET_OPERATIONS_H
@@ -0,0 +1,330 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_SORT_H
+#define LITESIMD_ALGORITHM_SORT_H
+
+#include <cstddef>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/algorithm/sorting_network.h>
+#include <litesimd/algorithm/detail/partition.h>
+
+namespace litesimd {
+
+namespace detail {
+
+// Partitions smaller than this number of registers are sorted by the sorting networks
+constexpr size_t sort_leaf_registers = 16;
+
+// Value used to pad the last register of the leaves, sorted after any other value
+template< typename ValueType_T >
+inline ValueType_T sort_sentinel()
+{
+    return std::numeric_limits< ValueType_T >::has_infinity
+                ? std::numeric_limits< ValueType_T >::infinity()
+                : std::numeric_limits< ValueType_T >::max();
+}
+
+template< size_t Size_T, typename ValueType_T, typename Tag_T >
+inline void sort_leaf_network( ValueType_T* first, size_t size )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    constexpr size_t simd_size = simd::simd_size;
+
+    ValueType_T buffer[ Size_T * simd_size ];
+    std::copy( first, first + size, buffer );
+    std::fill( buffer + size, buffer + Size_T * simd_size, sort_sentinel< ValueType_T >() );
+
+    simd regs[ Size_T ];
+    for( size_t i = 0; i < Size_T; ++i )
+        regs[ i ] = load< ValueType_T, Tag_T >( buffer + i * simd_size );
+
+    bitonic_sort( regs );
+
+    for( size_t i = 0; i < Size_T; ++i )
+        store< ValueType_T, Tag_T >( buffer + i * simd_size, regs[ i ] );
+    std::copy( buffer, buffer + size, first );
+}
+
+// Sorts up to sort_leaf_registers registers, padding the values up to the
+// next power of 2 registers
+template< typename ValueType_T, typename Tag_T >
+inline void sort_leaf( ValueType_T* first, size_t size )
+{
+    constexpr size_t simd_size = simd_type< ValueType_T, Tag_T >::simd_size;
+
+    if( size < 2 )
+        return;
+    if( size <= simd_size )
+        sort_leaf_network< 1, ValueType_T, Tag_T >( first, size );
+    else if( size <= 2 * simd_size )
+        sort_leaf_network< 2, ValueType_T, Tag_T >( first, size );
+    else if( size <= 4 * simd_size )
+        sort_leaf_network< 4, ValueType_T, Tag_T >( first, size );
+    else if( size <= 8 * simd_size )
+        sort_leaf_network< 8, ValueType_T, Tag_T >( first, size );
+    else
+        sort_leaf_network< 16, ValueType_T, Tag_T >( first, size );
+}
+
+template< typename ValueType_T >
+inline ValueType_T median_of_3( ValueType_T a, ValueType_T b, ValueType_T c )
+{
+    return std::max( std::min( a, b ), std::min( std::max( a, b ), c ) );
+}
+
+template< typename ValueType_T, typename Tag_T >
+inline void quicksort( ValueType_T* first, ValueType_T* last, int depth )
+{
+    constexpr ptrdiff_t leaf_size = sort_leaf_registers * simd_type< ValueType_T, Tag_T >::simd_size;
+
+    while( last - first > leaf_size )
+    {
+        // Too many bad pivots, avoids the quadratic worst case
+        if( depth-- == 0 )
+        {
+            std::sort( first, last );
+            return;
+        }
+
+        ptrdiff_t size = last - first;
+        ValueType_T pivot = median_of_3( first[ size / 4 ], first[ size / 2 ], first[ 3 * size / 4 ] );
+
+        ValueType_T* mid = simd_partition< ValueType_T, Tag_T >(
+                                first, last, less_than_selector< ValueType_T, Tag_T >( pivot ) );
+
+        if( mid == first )
+        {
+            // The pivot is the minimum, puts all its copies on the left and
+            // sorts only the greater values
+            first = simd_partition< ValueType_T, Tag_T >(
+                            first, last, less_equal_selector< ValueType_T, Tag_T >( pivot ) );
+            continue;
+        }
+
+        // Recursion on the smaller side bounds the stack size
+        if( mid - first < last - mid )
+        {
+            quicksort< ValueType_T, Tag_T >( first, mid, depth );
+            first = mid;
+        }
+        else
+        {
+            quicksort< ValueType_T, Tag_T >( mid, last, depth );
+            last = mid;
+        }
+    }
+    sort_leaf< ValueType_T, Tag_T >( first, static_cast< size_t >( last - first ) );
+}
+
+template< typename ValueType_T, typename Tag_T >
+inline void quickselect( ValueType_T* first, ValueType_T* nth, ValueType_T* last, int depth )
+{
+    constexpr ptrdiff_t leaf_size = sort_leaf_registers * simd_type< ValueType_T, Tag_T >::simd_size;
+
+    while( last - first > leaf_size )
+    {
+        if( depth-- == 0 )
+        {
+            std::nth_element( first, nth, last );
+            return;
+        }
+
+        ptrdiff_t size = last - first;
+        ValueType_T pivot = median_of_3( first[ size / 4 ], first[ size / 2 ], first[ 3 * size / 4 ] );
+
+        ValueType_T* mid = simd_partition< ValueType_T, Tag_T >(
+                                first, last, less_than_selector< ValueType_T, Tag_T >( pivot ) );
+
+        if( mid == first )
+        {
+            // All copies of the pivot, which is the minimum, are already on their places
+            first = simd_partition< ValueType_T, Tag_T >(
+                            first, last, less_equal_selector< ValueType_T, Tag_T >( pivot ) );
+            if( nth < first )
+                return;
+            continue;
+        }
+
+        // Only the side with the nth value is partitioned again
+        if( nth < mid )
+            last = mid;
+        else
+            first = mid;
+    }
+    sort_leaf< ValueType_T, Tag_T >( first, static_cast< size_t >( last - first ) );
+}
+
+// NaN values are not ordered with the pivots, they are moved to the end of the
+// range and only the values before them are partitioned
+template< typename ValueType_T, typename Tag_T >
+inline ValueType_T* sort_ordered_last( ValueType_T* first, ValueType_T* last, std::true_type )
+{
+    return simd_partition< ValueType_T, Tag_T >( first, last, ordered_selector< ValueType_T, Tag_T >() );
+}
+
+template< typename ValueType_T, typename Tag_T >
+inline ValueType_T* sort_ordered_last( ValueType_T*, ValueType_T* last, std::false_type )
+{
+    return last;
+}
+
+// Depth limit of the partitions before falling back to the std algorithms
+inline int sort_depth_limit( ptrdiff_t size )
+{
+    int depth = 0;
+    for( ; size > 1; size >>= 1 )
+        depth += 2;
+    return depth;
+}
+
+} // namespace detail
+
+/**
+ * \ingroup algorithm
+ * \brief Sorts the values of the range in ascending order with a vectorized quicksort.
+ *
+ * The partitions are made with a compress and two stores per SIMD register, without
+ * branches on the values. Partitions smaller than 16 registers are sorted by
+ * the bitonic sorting network. After too many bad pivots, the partition is sorted by
+ * `std::sort`. Only 32 and 64 bits values are supported. NaN values are moved to the
+ * end of the range, in no defined order, by one more partition before the sort. The
+ * sort is not stable.
+ *
+ * \param first Pointer to the first value of the range
+ * \param last Pointer past the last value of the range
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values = { 5, 3, 9, 1, 7, 2, 8, 6, 4, 0 };
+ *     ls::sort( values.data(), values.data() + values.size() );
+ *
+ *     for( auto v : values )
+ *         std::cout << v << " ";
+ *     std::cout << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * 0 1 2 3 4 5 6 7 8 9
+ * ```
+ *
+ * \see bitonic_sort
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline void sort( ValueType_T* first, ValueType_T* last )
+{
+    static_assert( sizeof( ValueType_T ) == 4 || sizeof( ValueType_T ) == 8,
+                   "Only 32 and 64 bits values are supported" );
+
+    last = detail::sort_ordered_last< ValueType_T, Tag_T >( first, last, std::is_floating_point< ValueType_T >() );
+    detail::quicksort< ValueType_T, Tag_T >( first, last, detail::sort_depth_limit( last - first ) );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Reorders the range so the value at _nth_ is the one on this position on the
+ * sorted range.
+ *
+ * The values before _nth_ are lesser or equal, and the values after are greater or
+ * equal to it. It is a quickselect with the same partitions of sort, only the side
+ * holding _nth_ is partitioned again. After too many bad pivots, the partition is
+ * ordered by `std::nth_element`. Only 32 and 64 bits values are supported. NaN values
+ * are placed after all the other values, like sort.
+ *
+ * \param first, last Range of values
+ * \param nth Position of the value to select
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< float > latency = { 12.5f, 3.0f, 7.25f, 30.0f, 1.5f, 9.0f, 4.0f };
+ *     float* median = latency.data() + latency.size() / 2;
+ *     ls::nth_element( latency.data(), median, latency.data() + latency.size() );
+ *     std::cout << "median: " << *median << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * median: 7.25
+ * ```
+ *
+ * \see partial_sort, partition, sort
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline void nth_element( ValueType_T* first, ValueType_T* nth, ValueType_T* last )
+{
+    static_assert( sizeof( ValueType_T ) == 4 || sizeof( ValueType_T ) == 8,
+                   "Only 32 and 64 bits values are supported" );
+    if( nth == last )
+        return;
+
+    last = detail::sort_ordered_last< ValueType_T, Tag_T >( first, last, std::is_floating_point< ValueType_T >() );
+    if( !(nth < last) )
+        return;
+    detail::quickselect< ValueType_T, Tag_T >( first, nth, last, detail::sort_depth_limit( last - first ) );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Sorts the lowest values of the range on [first, middle).
+ *
+ * Selects the values with nth_element and sorts them with sort. The order of the
+ * values on [middle, last) is not specified. Only 32 and 64 bits values are supported,
+ * NaN values are placed after all the other values.
+ *
+ * \param first, last Range of values
+ * \param middle End of the sorted values
+ *
+ * \see nth_element, sort
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline void partial_sort( ValueType_T* first, ValueType_T* middle, ValueType_T* last )
+{
+    nth_element< Tag_T >( first, middle, last );
+    sort< Tag_T >( first, middle );
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ALGORITHM_SORT_H
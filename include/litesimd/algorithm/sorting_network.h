@@ -0,0 +1,484 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_SORTING_NETWORK_H
+#define LITESIMD_ALGORITHM_SORTING_NETWORK_H
+
+#include <cstddef>
+#include <utility>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/shuffle.h>
+#include <litesimd/detail/arch/sse/algorithm.h>
+#include <litesimd/detail/arch/avx/algorithm.h>
+#include <litesimd/algorithm/detail/sorting_network_tables.h>
+
+namespace litesimd {
+
+namespace detail {
+
+// Compare exchange of two registers, the lesser values go to _a_
+template< typename ValueType_T, typename Tag_T >
+inline void network_exchange( simd_type< ValueType_T, Tag_T >& a, simd_type< ValueType_T, Tag_T >& b )
+{
+    simd_type< ValueType_T, Tag_T > lo = min< ValueType_T, Tag_T >( a, b );
+    b = max< ValueType_T, Tag_T >( a, b );
+    a = lo;
+}
+
+template< typename ValueType_T, typename Payload_T, typename Tag_T >
+inline void network_exchange( simd_type< ValueType_T, Tag_T >& a, simd_type< ValueType_T, Tag_T >& b,
+                              simd_type< Payload_T, Tag_T >& pa, simd_type< Payload_T, Tag_T >& pb )
+{
+    simd_type< ValueType_T, Tag_T > swap = greater< ValueType_T, Tag_T >( a, b );
+    simd_type< Payload_T, Tag_T > pswap = reinterpret< Payload_T >( swap );
+
+    simd_type< ValueType_T, Tag_T > lo = blend< ValueType_T, Tag_T >( swap, b, a );
+    b = blend< ValueType_T, Tag_T >( swap, a, b );
+    a = lo;
+
+    simd_type< Payload_T, Tag_T > plo = blend< Payload_T, Tag_T >( pswap, pb, pa );
+    pb = blend< Payload_T, Tag_T >( pswap, pa, pb );
+    pa = plo;
+}
+
+// Applies all stages of a network table inside one register
+template< typename Table_T, typename ValueType_T, typename Tag_T >
+inline void network_apply( simd_type< ValueType_T, Tag_T >& keys )
+{
+    using index_type = typename permute_index< ValueType_T >::type;
+    for( size_t stage = 0; stage < Table_T::stages; ++stage )
+    {
+        simd_type< index_type, Tag_T > partner =
+            load< index_type, Tag_T >( Table_T::template partner< index_type >( stage ) );
+        simd_type< ValueType_T, Tag_T > mask = reinterpret< ValueType_T >(
+            load< index_type, Tag_T >( Table_T::template min_mask< index_type >( stage ) ) );
+
+        simd_type< ValueType_T, Tag_T > other = permute< ValueType_T, Tag_T >( keys, partner );
+        keys = blend< ValueType_T, Tag_T >( mask, min< ValueType_T, Tag_T >( keys, other ),
+                                                  max< ValueType_T, Tag_T >( keys, other ) );
+    }
+}
+
+template< typename Table_T, typename ValueType_T, typename Payload_T, typename Tag_T >
+inline void network_apply( simd_type< ValueType_T, Tag_T >& keys, simd_type< Payload_T, Tag_T >& payload )
+{
+    using index_type = typename permute_index< ValueType_T >::type;
+    for( size_t stage = 0; stage < Table_T::stages; ++stage )
+    {
+        simd_type< index_type, Tag_T > partner =
+            load< index_type, Tag_T >( Table_T::template partner< index_type >( stage ) );
+        simd_type< ValueType_T, Tag_T > mask = reinterpret< ValueType_T >(
+            load< index_type, Tag_T >( Table_T::template min_mask< index_type >( stage ) ) );
+
+        simd_type< ValueType_T, Tag_T > other = permute< ValueType_T, Tag_T >( keys, partner );
+        simd_type< Payload_T, Tag_T > other_payload = permute< Payload_T, Tag_T >( payload, partner );
+
+        // Both indexes of a pair agree to swap, so equal keys keep their own payload
+        simd_type< ValueType_T, Tag_T > take = blend< ValueType_T, Tag_T >( mask,
+                                                    greater< ValueType_T, Tag_T >( keys, other ),
+                                                    greater< ValueType_T, Tag_T >( other, keys ) );
+        keys = blend< ValueType_T, Tag_T >( take, other, keys );
+        payload = blend< Payload_T, Tag_T >( reinterpret< Payload_T >( take ), other_payload, payload );
+    }
+}
+
+template< typename ValueType_T, typename Tag_T >
+inline void network_reverse( simd_type< ValueType_T, Tag_T >& keys )
+{
+    keys = reverse< ValueType_T, Tag_T >( keys );
+}
+
+template< typename ValueType_T, typename Payload_T, typename Tag_T >
+inline void network_reverse( simd_type< ValueType_T, Tag_T >& keys, simd_type< Payload_T, Tag_T >& payload )
+{
+    keys = reverse< ValueType_T, Tag_T >( keys );
+    payload = reverse< Payload_T, Tag_T >( payload );
+}
+
+template< typename ValueType_T, typename Tag_T >
+inline void network_swap( simd_type< ValueType_T, Tag_T >* keys, size_t i, size_t j )
+{
+    std::swap( keys[ i ], keys[ j ] );
+}
+
+template< typename ValueType_T, typename Payload_T, typename Tag_T >
+inline void network_swap( simd_type< ValueType_T, Tag_T >* keys, simd_type< Payload_T, Tag_T >* payload,
+                          size_t i, size_t j )
+{
+    std::swap( keys[ i ], keys[ j ] );
+    std::swap( payload[ i ], payload[ j ] );
+}
+
+// Sorts a bitonic sequence of _size_ registers. _size_ must be power of 2.
+template< typename ValueType_T, typename Tag_T, typename... Payload_T >
+inline void network_bitonic_clean( size_t size, simd_type< ValueType_T, Tag_T >* keys,
+                                   simd_type< Payload_T, Tag_T >*... payload )
+{
+    constexpr size_t simd_size = simd_type< ValueType_T, Tag_T >::simd_size;
+
+    // Compares values on different registers...
+    for( size_t dist = size / 2; dist > 0; dist /= 2 )
+    {
+        for( size_t i = 0; i < size; ++i )
+        {
+            if( (i & dist) == 0 )
+                network_exchange( keys[ i ], keys[ i + dist ], payload[ i ]..., payload[ i + dist ]... );
+        }
+    }
+
+    // ... then inside each register
+    for( size_t i = 0; i < size; ++i )
+        network_apply< bitonic_merge_table< simd_size > >( keys[ i ], payload[ i ]... );
+}
+
+// Merges the sorted runs [0, size) and [size, 2*size) of registers
+template< typename ValueType_T, typename Tag_T, typename... Payload_T >
+inline void network_merge_runs( size_t size, simd_type< ValueType_T, Tag_T >* keys,
+                                simd_type< Payload_T, Tag_T >*... payload )
+{
+    // Reversing the second run makes the 2*size registers a bitonic sequence
+    for( size_t i = 0; i < size / 2; ++i )
+        network_swap( keys, payload..., size + i, 2 * size - 1 - i );
+
+    for( size_t i = size; i < 2 * size; ++i )
+        network_reverse( keys[ i ], payload[ i ]... );
+
+    network_bitonic_clean( 2 * size, keys, payload... );
+}
+
+// Sorts each register with the network table and merges them
+template< typename Table_T, typename ValueType_T, typename Tag_T, typename... Payload_T >
+inline void network_sort( size_t size, simd_type< ValueType_T, Tag_T >* keys,
+                          simd_type< Payload_T, Tag_T >*... payload )
+{
+    for( size_t i = 0; i < size; ++i )
+        network_apply< Table_T >( keys[ i ], payload[ i ]... );
+
+    for( size_t run = 1; run < size; run *= 2 )
+    {
+        for( size_t base = 0; base < size; base += 2 * run )
+            network_merge_runs( run, keys + base, (payload + base)... );
+    }
+}
+
+constexpr bool is_power_of_2( size_t size )
+{
+    return size != 0 && (size & (size - 1)) == 0;
+}
+
+} // namespace detail
+
+// Bitonic sort
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup algorithm
+ * \brief Sorts the values inside the SIMD register with a bitonic sorting network.
+ *
+ * The values are sorted on ascending order, the lesser value goes to index 0. Only
+ * 32 and 64 bits values are supported.
+ *
+ * \param vec SIMD register to be sorted
+ * \returns SIMD register with the values sorted
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/algorithm.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::simd_type< int32_t, ls::sse_tag > x( 2, 4, 1, 3 );
+ *     std::cout << "bitonic_sort( x ): " << ls::bitonic_sort( x ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * bitonic_sort( x ): (4, 3, 2, 1)
+ * ```
+ *
+ * \see odd_even_merge_sort, bitonic_merge
+ */
+template< typename ValueType_T, typename Tag_T >
+inline simd_type< ValueType_T, Tag_T > bitonic_sort( simd_type< ValueType_T, Tag_T > vec )
+{
+    detail::network_apply< detail::bitonic_sort_table< simd_type< ValueType_T, Tag_T >::simd_size > >( vec );
+    return vec;
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Sorts the keys inside the SIMD register with a bitonic sorting network,
+ * moving the payload values along the keys.
+ *
+ * The payload register must have values of the same size of the keys, eg. `int32_t` keys
+ * and `float` payload. Equal keys keep their original payload on the same index.
+ *
+ * \param keys SIMD register to be sorted
+ * \param payload SIMD register permuted as the keys
+ *
+ * \see odd_even_merge_sort, bitonic_merge
+ */
+template< typename ValueType_T, typename Payload_T, typename Tag_T >
+inline void bitonic_sort( simd_type< ValueType_T, Tag_T >& keys, simd_type< Payload_T, Tag_T >& payload )
+{
+    static_assert( sizeof( ValueType_T ) == sizeof( Payload_T ), "Keys and payload must have the same size" );
+    detail::network_apply< detail::bitonic_sort_table< simd_type< ValueType_T, Tag_T >::simd_size > >( keys, payload );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Sorts the values of several SIMD registers with a bitonic sorting network.
+ *
+ * The values of all registers are sorted as one sequence, the lesser value goes to the
+ * index 0 of the first register. Each register is sorted with bitonic_sort and then the
+ * registers are merged with bitonic merge networks. The number of registers must be a
+ * power of 2.
+ *
+ * \param keys Array of SIMD registers to be sorted
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/algorithm.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *     using simd = ls::simd_type< int32_t, ls::sse_tag >;
+ *
+ *     simd regs[ 2 ] = { simd( 2, 8, 1, 6 ), simd( 5, 3, 7, 4 ) };
+ *     ls::bitonic_sort( regs );
+ *     std::cout << regs[ 0 ] << " " << regs[ 1 ] << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * (4, 3, 2, 1) (8, 7, 6, 5)
+ * ```
+ */
+template< size_t Size_T, typename ValueType_T, typename Tag_T >
+inline void bitonic_sort( simd_type< ValueType_T, Tag_T > (&keys)[ Size_T ] )
+{
+    static_assert( detail::is_power_of_2( Size_T ), "The number of registers must be power of 2" );
+    detail::network_sort< detail::bitonic_sort_table< simd_type< ValueType_T, Tag_T >::simd_size > >(
+        Size_T, keys );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Sorts the keys of several SIMD registers with a bitonic sorting network,
+ * moving the payload values along the keys.
+ *
+ * \param keys Array of SIMD registers to be sorted
+ * \param payload Array of SIMD registers permuted as the keys
+ *
+ * \see bitonic_sort
+ */
+template< size_t Size_T, typename ValueType_T, typename Payload_T, typename Tag_T >
+inline void bitonic_sort( simd_type< ValueType_T, Tag_T > (&keys)[ Size_T ],
+                          simd_type< Payload_T, Tag_T > (&payload)[ Size_T ] )
+{
+    static_assert( detail::is_power_of_2( Size_T ), "The number of registers must be power of 2" );
+    static_assert( sizeof( ValueType_T ) == sizeof( Payload_T ), "Keys and payload must have the same size" );
+    detail::network_sort< detail::bitonic_sort_table< simd_type< ValueType_T, Tag_T >::simd_size > >(
+        Size_T, keys, payload );
+}
+
+// Odd-even merge sort
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup algorithm
+ * \brief Sorts the values inside the SIMD register with a Batcher odd-even merge sorting network.
+ *
+ * It has the same depth of bitonic_sort with fewer comparisons, so the results are the
+ * same with different idle indexes on each stage. Only 32 and 64 bits values are supported.
+ *
+ * \param vec SIMD register to be sorted
+ * \returns SIMD register with the values sorted
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/algorithm.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::simd_type< double, ls::sse_tag > x( 1.5, 2.5 );
+ *     std::cout << "odd_even_merge_sort( x ): " << ls::odd_even_merge_sort( x ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * odd_even_merge_sort( x ): (2.5, 1.5)
+ * ```
+ *
+ * \see bitonic_sort
+ */
+template< typename ValueType_T, typename Tag_T >
+inline simd_type< ValueType_T, Tag_T > odd_even_merge_sort( simd_type< ValueType_T, Tag_T > vec )
+{
+    detail::network_apply< detail::odd_even_sort_table< simd_type< ValueType_T, Tag_T >::simd_size > >( vec );
+    return vec;
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Sorts the keys inside the SIMD register with a Batcher odd-even merge sorting network,
+ * moving the payload values along the keys.
+ *
+ * \param keys SIMD register to be sorted
+ * \param payload SIMD register permuted as the keys
+ *
+ * \see bitonic_sort
+ */
+template< typename ValueType_T, typename Payload_T, typename Tag_T >
+inline void odd_even_merge_sort( simd_type< ValueType_T, Tag_T >& keys, simd_type< Payload_T, Tag_T >& payload )
+{
+    static_assert( sizeof( ValueType_T ) == sizeof( Payload_T ), "Keys and payload must have the same size" );
+    detail::network_apply< detail::odd_even_sort_table< simd_type< ValueType_T, Tag_T >::simd_size > >( keys, payload );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Sorts the values of several SIMD registers.
+ *
+ * Each register is sorted with the odd-even merge network and then the registers are
+ * merged with bitonic merge networks. The number of registers must be a power of 2.
+ *
+ * \param keys Array of SIMD registers to be sorted
+ *
+ * \see bitonic_sort
+ */
+template< size_t Size_T, typename ValueType_T, typename Tag_T >
+inline void odd_even_merge_sort( simd_type< ValueType_T, Tag_T > (&keys)[ Size_T ] )
+{
+    static_assert( detail::is_power_of_2( Size_T ), "The number of registers must be power of 2" );
+    detail::network_sort< detail::odd_even_sort_table< simd_type< ValueType_T, Tag_T >::simd_size > >(
+        Size_T, keys );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Sorts the keys of several SIMD registers, moving the payload values along the keys.
+ *
+ * \param keys Array of SIMD registers to be sorted
+ * \param payload Array of SIMD registers permuted as the keys
+ *
+ * \see bitonic_sort
+ */
+template< size_t Size_T, typename ValueType_T, typename Payload_T, typename Tag_T >
+inline void odd_even_merge_sort( simd_type< ValueType_T, Tag_T > (&keys)[ Size_T ],
+                                 simd_type< Payload_T, Tag_T > (&payload)[ Size_T ] )
+{
+    static_assert( detail::is_power_of_2( Size_T ), "The number of registers must be power of 2" );
+    static_assert( sizeof( ValueType_T ) == sizeof( Payload_T ), "Keys and payload must have the same size" );
+    detail::network_sort< detail::odd_even_sort_table< simd_type< ValueType_T, Tag_T >::simd_size > >(
+        Size_T, keys, payload );
+}
+
+// Bitonic merge
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup algorithm
+ * \brief Merges two sorted SIMD registers.
+ *
+ * After the merge, _a_ has the lesser half of the values and _b_ the greater half, both
+ * sorted.
+ *
+ * \param a, b Sorted SIMD registers
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/algorithm.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *     using simd = ls::simd_type< int32_t, ls::sse_tag >;
+ *
+ *     simd a( 7, 5, 3, 1 ), b( 8, 6, 4, 2 );
+ *     ls::bitonic_merge( a, b );
+ *     std::cout << a << " " << b << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * (4, 3, 2, 1) (8, 7, 6, 5)
+ * ```
+ *
+ * \see bitonic_sort
+ */
+template< typename ValueType_T, typename Tag_T >
+inline void bitonic_merge( simd_type< ValueType_T, Tag_T >& a, simd_type< ValueType_T, Tag_T >& b )
+{
+    b = reverse< ValueType_T, Tag_T >( b );
+    detail::network_exchange( a, b );
+
+    constexpr size_t simd_size = simd_type< ValueType_T, Tag_T >::simd_size;
+    detail::network_apply< detail::bitonic_merge_table< simd_size > >( a );
+    detail::network_apply< detail::bitonic_merge_table< simd_size > >( b );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Merges two sorted SIMD registers, moving the payload values along the keys.
+ *
+ * \param a, b Sorted SIMD registers
+ * \param pa, pb Payload of _a_ and _b_
+ *
+ * \see bitonic_merge
+ */
+template< typename ValueType_T, typename Payload_T, typename Tag_T >
+inline void bitonic_merge( simd_type< ValueType_T, Tag_T >& a, simd_type< ValueType_T, Tag_T >& b,
+                           simd_type< Payload_T, Tag_T >& pa, simd_type< Payload_T, Tag_T >& pb )
+{
+    static_assert( sizeof( ValueType_T ) == sizeof( Payload_T ), "Keys and payload must have the same size" );
+    detail::network_reverse( b, pb );
+    detail::network_exchange( a, b, pa, pb );
+
+    constexpr size_t simd_size = simd_type< ValueType_T, Tag_T >::simd_size;
+    detail::network_apply< detail::bitonic_merge_table< simd_size > >( a, pa );
+    detail::network_apply< detail::bitonic_merge_table< simd_size > >( b, pb );
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ALGORITHM_SORTING_NETWORK_H
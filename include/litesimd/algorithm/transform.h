@@ -0,0 +1,314 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_TRANSFORM_H
+#define LITESIMD_ALGORITHM_TRANSFORM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+
+namespace litesimd {
+
+/**
+ * \ingroup algorithm
+ * \brief Store policy for transform, stores the results through the cache (default).
+ */
+struct temporal_store {};
+
+/**
+ * \ingroup algorithm
+ * \brief Store policy for transform, uses non-temporal stores on the output.
+ *
+ * Best suited for outputs bigger than the last level cache, which will not be read soon.
+ */
+struct non_temporal_store {};
+
+namespace detail {
+
+template< typename ValueType_T, typename Tag_T >
+inline void transform_store( ValueType_T* ptr, simd_type< ValueType_T, Tag_T > vec, temporal_store )
+{
+    store< ValueType_T, Tag_T >( ptr, vec );
+}
+
+template< typename ValueType_T, typename Tag_T >
+inline void transform_store( ValueType_T* ptr, simd_type< ValueType_T, Tag_T > vec, non_temporal_store )
+{
+    stream< ValueType_T, Tag_T >( ptr, vec );
+}
+
+template< typename Tag_T >
+inline void transform_fence( temporal_store ) {}
+
+template< typename Tag_T >
+inline void transform_fence( non_temporal_store ) { stream_fence< Tag_T >(); }
+
+// Count of values until the output is aligned to the SIMD register size
+template< typename ValueType_T, typename Tag_T >
+inline ptrdiff_t transform_peel( const ValueType_T* out )
+{
+    constexpr size_t register_size = sizeof( typename simd_type< ValueType_T, Tag_T >::inner_type );
+    uintptr_t addr = reinterpret_cast< uintptr_t >( out );
+    return static_cast< ptrdiff_t >( ((register_size - addr % register_size) % register_size)
+                                     / sizeof( ValueType_T ) );
+}
+
+template< size_t Unroll_T, typename ValueType_T, typename Tag_T, typename Op_T, typename Store_T >
+inline void transform_main( ValueType_T* out, ptrdiff_t i, ptrdiff_t size, Op_T& op, Store_T policy )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    constexpr ptrdiff_t simd_size = simd::simd_size;
+    constexpr ptrdiff_t step = simd_size * Unroll_T;
+
+    for( ; i + step <= size; i += step )
+    {
+        simd vec[ Unroll_T ];
+        for( size_t u = 0; u < Unroll_T; ++u )
+            vec[ u ] = op.compute( i + u * simd_size );
+
+        for( size_t u = 0; u < Unroll_T; ++u )
+            transform_store< ValueType_T, Tag_T >( out + i + u * simd_size, vec[ u ], policy );
+    }
+    for( ; i + simd_size <= size; i += simd_size )
+    {
+        transform_store< ValueType_T, Tag_T >( out + i, op.compute( i ), policy );
+    }
+}
+
+template< typename Store_T > struct is_store_policy : std::false_type {};
+template<> struct is_store_policy< temporal_store > : std::true_type {};
+template<> struct is_store_policy< non_temporal_store > : std::true_type {};
+
+// Generic driver for unary and binary transforms. The _op_ object loads and
+// computes the SIMD register starting at one index.
+//
+// The first and the last SIMD registers of the range are computed before any
+// store and stored after the main loop, so the head and tail can overlap the
+// aligned main loop without reading already transformed values. This keeps
+// the in place transform (out == first) correct.
+template< size_t Unroll_T, typename ValueType_T, typename Tag_T, typename Op_T, typename Store_T >
+inline ValueType_T* transform_loop( ValueType_T* out, ptrdiff_t size, Op_T& op, Store_T policy )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    constexpr ptrdiff_t simd_size = simd::simd_size;
+
+    if( size < simd_size )
+    {
+        for( ptrdiff_t i = 0; i < size; ++i )
+            op.scalar( i );
+        return out + size;
+    }
+
+    simd head = op.compute( 0 );
+    simd tail = op.compute( size - simd_size );
+
+    if( reinterpret_cast< uintptr_t >( out ) % sizeof( ValueType_T ) != 0 )
+    {
+        // Misaligned values can't be aligned neither use the non-temporal store
+        transform_main< Unroll_T, ValueType_T, Tag_T >( out, 0, size, op, temporal_store() );
+    }
+    else
+    {
+        transform_main< Unroll_T, ValueType_T, Tag_T >( out, transform_peel< ValueType_T, Tag_T >( out ),
+                                                        size, op, policy );
+        transform_fence< Tag_T >( policy );
+    }
+
+    store< ValueType_T, Tag_T >( out, head );
+    store< ValueType_T, Tag_T >( out + size - simd_size, tail );
+    return out + size;
+}
+
+template< typename InValue_T, typename OutValue_T, typename Tag_T,
+          typename SimdFunction_T, typename ScalarFunction_T >
+struct unary_transform_op
+{
+    const InValue_T* in;
+    OutValue_T* out;
+    SimdFunction_T& simd_fn;
+    ScalarFunction_T& scalar_fn;
+
+    inline simd_type< OutValue_T, Tag_T > compute( ptrdiff_t i )
+    {
+        return simd_fn( load< InValue_T, Tag_T >( in + i ) );
+    }
+
+    inline void scalar( ptrdiff_t i ) { out[ i ] = scalar_fn( in[ i ] ); }
+};
+
+template< typename InValue_T, typename OutValue_T, typename Tag_T,
+          typename SimdFunction_T, typename ScalarFunction_T >
+struct binary_transform_op
+{
+    const InValue_T* in1;
+    const InValue_T* in2;
+    OutValue_T* out;
+    SimdFunction_T& simd_fn;
+    ScalarFunction_T& scalar_fn;
+
+    inline simd_type< OutValue_T, Tag_T > compute( ptrdiff_t i )
+    {
+        return simd_fn( load< InValue_T, Tag_T >( in1 + i ), load< InValue_T, Tag_T >( in2 + i ) );
+    }
+
+    inline void scalar( ptrdiff_t i ) { out[ i ] = scalar_fn( in1[ i ], in2[ i ] ); }
+};
+
+} // namespace detail
+
+/**
+ * \ingroup algorithm
+ * \brief Applies a SIMD function to the range [first, last) and stores the result on _out_.
+ *
+ * The range is processed with one SIMD register at a time, calling _simd_fn_ with
+ * `simd_type< InValue_T, Tag_T >` and storing the returned `simd_type< OutValue_T, Tag_T >`.
+ * The output is aligned by an unaligned head register, the main loop is unrolled
+ * _Unroll_T_ times and the tail is covered by one register overlapping the last values
+ * of the main loop. _scalar_fn_ is only called for ranges smaller than one SIMD register.
+ *
+ * The output can be the same of the input (in place transform), but can't partially
+ * overlap it. As the head and tail registers may be computed twice, _simd_fn_ must
+ * compute each value independently.
+ *
+ * \param first, last Range of values to transform
+ * \param out Beginning of the output range
+ * \param simd_fn SIMD function, `simd_type< OutValue_T, Tag_T > simd_fn( simd_type< InValue_T, Tag_T > )`
+ * \param scalar_fn Scalar function, `OutValue_T scalar_fn( InValue_T )`
+ * \param policy temporal_store (default) or non_temporal_store
+ * \tparam Tag_T Metaprogramming tag for instruction set selection.
+ * \tparam Unroll_T How many SIMD registers are computed on each loop iteration
+ * \returns Output iterator to the element past the last element transformed
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <string>
+ * #include <litesimd/algorithm.h>
+ * #include <litesimd/arithmetic.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *     using simd = ls::simd_type< int8_t, ls::sse_tag >;
+ *
+ *     std::string str( "HELLO, SIMD WORLD!" );
+ *     int8_t* data = reinterpret_cast< int8_t* >( &str[ 0 ] );
+ *
+ *     ls::transform< ls::sse_tag >( data, data + str.size(), data,
+ *         []( simd val ) { return ls::add< int8_t, ls::sse_tag >( val, simd( 1 ) ); },
+ *         []( int8_t val ) { return static_cast< int8_t >( val + 1 ); } );
+ *
+ *     std::cout << str << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * IFMMP-!TJNE!XPSME"
+ * ```
+ */
+template< typename Tag_T = default_tag, size_t Unroll_T = 4,
+          typename InValue_T, typename OutValue_T,
+          typename SimdFunction_T, typename ScalarFunction_T,
+          typename Store_T = temporal_store,
+          typename std::enable_if< detail::is_store_policy< Store_T >::value >::type* = nullptr >
+inline OutValue_T* transform( const InValue_T* first, const InValue_T* last, OutValue_T* out,
+                              SimdFunction_T simd_fn, ScalarFunction_T scalar_fn,
+                              Store_T policy = Store_T() )
+{
+    static_assert( sizeof( InValue_T ) == sizeof( OutValue_T ),
+                   "Input and output registers must have the same size" );
+
+    detail::unary_transform_op< InValue_T, OutValue_T, Tag_T, SimdFunction_T, ScalarFunction_T >
+        op{ first, out, simd_fn, scalar_fn };
+    return detail::transform_loop< Unroll_T, OutValue_T, Tag_T >( out, last - first, op, policy );
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Applies a SIMD function to the ranges [first1, last1) and [first2, ...)
+ * and stores the result on _out_.
+ *
+ * This is the binary version of transform, _simd_fn_ is called with one register of
+ * each input range. The output can be the same of any of the inputs.
+ *
+ * \param first1, last1 First range of values to transform
+ * \param first2 Beginning of the second range of values to transform
+ * \param out Beginning of the output range
+ * \param simd_fn SIMD function, `simd_type< OutValue_T, Tag_T > simd_fn( simd_type< InValue_T, Tag_T >, simd_type< InValue_T, Tag_T > )`
+ * \param scalar_fn Scalar function, `OutValue_T scalar_fn( InValue_T, InValue_T )`
+ * \param policy temporal_store (default) or non_temporal_store
+ * \tparam Tag_T Metaprogramming tag for instruction set selection.
+ * \tparam Unroll_T How many SIMD registers are computed on each loop iteration
+ * \returns Output iterator to the element past the last element transformed
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ * #include <litesimd/arithmetic.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *     using simd = ls::simd_type< float, ls::sse_tag >;
+ *
+ *     std::vector< float > a = { 1, 2, 3, 4, 5 }, b = { 10, 20, 30, 40, 50 };
+ *     ls::transform< ls::sse_tag >( a.data(), a.data() + a.size(), b.data(), a.data(),
+ *         []( simd x, simd y ) { return ls::add< float, ls::sse_tag >( x, y ); },
+ *         []( float x, float y ) { return x + y; } );
+ *
+ *     for( float v : a )
+ *         std::cout << v << " ";
+ *     std::cout << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * 11 22 33 44 55
+ * ```
+ */
+template< typename Tag_T = default_tag, size_t Unroll_T = 4,
+          typename InValue_T, typename OutValue_T,
+          typename SimdFunction_T, typename ScalarFunction_T,
+          typename Store_T = temporal_store >
+inline OutValue_T* transform( const InValue_T* first1, const InValue_T* last1,
+                              const InValue_T* first2, OutValue_T* out,
+                              SimdFunction_T simd_fn, ScalarFunction_T scalar_fn,
+                              Store_T policy = Store_T() )
+{
+    static_assert( sizeof( InValue_T ) == sizeof( OutValue_T ),
+                   "Input and output registers must have the same size" );
+
+    detail::binary_transform_op< InValue_T, OutValue_T, Tag_T, SimdFunction_T, ScalarFunction_T >
+        op{ first1, first2, out, simd_fn, scalar_fn };
+    return detail::transform_loop< Unroll_T, OutValue_T, Tag_T >( out, last1 - first1, op, policy );
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ALGORITHM_TRANSFORM_H
@@ -0,0 +1,172 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ALGORITHM_UNIQUE_H
+#define LITESIMD_ALGORITHM_UNIQUE_H
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/bitwise.h>
+#include <litesimd/shuffle.h>
+#include <litesimd/algorithm/detail/compress_output.h>
+
+namespace litesimd {
+
+namespace detail {
+
+// Type of the SIMD register, integers of any signedness are compared as signed
+template< typename ValueType_T >
+struct unique_value
+{
+    static_assert( sizeof( ValueType_T ) == 4 || sizeof( ValueType_T ) == 8,
+                   "Only 32 and 64 bits values are supported" );
+    using type = typename std::conditional< std::is_integral< ValueType_T >::value,
+                                            typename permute_index< ValueType_T >::type,
+                                            ValueType_T >::type;
+};
+
+template< typename Tag_T, typename ValueType_T, typename Output_T >
+inline void unique( const ValueType_T* first, const ValueType_T* last, Output_T& out )
+{
+    using simd_value_type = typename unique_value< ValueType_T >::type;
+    using simd = simd_type< simd_value_type, Tag_T >;
+    constexpr ptrdiff_t simd_size = simd::simd_size;
+
+    if( first == last )
+        return;
+
+    out.put( *first );
+    simd_value_type prev;
+    std::memcpy( &prev, first, sizeof( prev ) );
+    ++first;
+
+    // Compares each value with the previous one, shifting the register one index higher
+    for( ; last - first >= simd_size; first += simd_size )
+    {
+        simd vec = load< simd_value_type, Tag_T >( reinterpret_cast< const simd_value_type* >( first ) );
+        simd repeated = equal_to< simd_value_type, Tag_T >( vec, low_insert< simd_value_type, Tag_T >( vec, prev ) );
+        out.put( bit_not< simd_value_type, Tag_T >( repeated ), vec );
+        prev = get< simd_size - 1 >( vec );
+    }
+
+    ValueType_T prev_value;
+    std::memcpy( &prev_value, &prev, sizeof( prev ) );
+    for( ; first != last; ++first )
+    {
+        if( !(*first == prev_value) )
+            out.put( *first );
+        prev_value = *first;
+    }
+}
+
+} // namespace detail
+
+/**
+ * \ingroup algorithm
+ * \brief Removes the consecutive repeated values of the range, in place.
+ *
+ * Each SIMD register is compared with itself shifted by low_insert, which inserts the
+ * last value of the previous register, and the values different from the previous
+ * one are written with compress. Like `std::unique`, the values after the returned
+ * pointer are left unspecified. Only 32 and 64 bits values are supported.
+ *
+ * \param first, last Range of values, usually sorted
+ * \returns Pointer past the last value kept
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/algorithm.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values = { 1, 1, 2, 3, 3, 3, 4, 5, 5, 6 };
+ *     values.resize( ls::unique( values.data(), values.data() + values.size() ) - values.data() );
+ *
+ *     for( auto v : values )
+ *         std::cout << v << " ";
+ *     std::cout << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * 1 2 3 4 5 6
+ * ```
+ *
+ * \see unique_copy, unique_count
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline ValueType_T* unique( ValueType_T* first, ValueType_T* last )
+{
+    // The compress stores never pass the register being read
+    detail::compress_output< ValueType_T > output( first, last );
+    detail::unique< Tag_T >( static_cast< const ValueType_T* >( first ), last, output );
+    return output.result();
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Copies the range to the output, without the consecutive repeated values.
+ *
+ * \param first, last Range of values, usually sorted
+ * \param out Beginning of the output, with room for all values of the range
+ * \returns Pointer past the last value written
+ *
+ * \see unique, unique_count
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline ValueType_T* unique_copy( const ValueType_T* first, const ValueType_T* last, ValueType_T* out )
+{
+    detail::compress_output< ValueType_T > output( out, out + (last - first) );
+    detail::unique< Tag_T >( first, last, output );
+    return output.result();
+}
+
+/**
+ * \ingroup algorithm
+ * \brief Number of values of the range different from the previous one, which is
+ * the number of distinct values of a sorted range.
+ *
+ * \param first, last Range of values, usually sorted
+ * \returns Number of values kept by unique
+ *
+ * \see unique, unique_copy
+ */
+template< typename Tag_T = default_tag, typename ValueType_T >
+inline size_t unique_count( const ValueType_T* first, const ValueType_T* last )
+{
+    detail::compress_counter< ValueType_T > counter;
+    detail::unique< Tag_T >( first, last, counter );
+    return counter.result();
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ALGORITHM_UNIQUE_H
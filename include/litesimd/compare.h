@@ -30,7 +30,10 @@
 #include <x86intrin.h>
 #endif
 #include <type_traits>
+#include <cstddef>
+#include <cstdint>
 #include <litesimd/types.h>
+#include <litesimd/memory.h>
 #include <litesimd/detail/arch/compare.h>
 #include <litesimd/detail/helper_macros.h>
 
@@ -306,6 +309,103 @@ greater_first_index( simd_type< ValueType_T, Tag_T > lhs,
 
 DEFINE_BINARY_FUNCTION_ADAPTORS( greater_first_index, index_type )
 
+// Greater on nodes of many registers
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup compare
+ * \brief Compares a SIMD register with all values of a node and returns a 64 bits bitmask
+ *
+ * A node is an array of NodeSize_T values, several SIMD registers long, like a cache
+ * line of a search tree. The value is compared with each register of the node and the
+ * masks are combined in one bitmask with one bit for each value of the node.
+ *
+ * The first form sets the bit `i` when the lhs values are greater than `node[ i ]` and
+ * the second form sets the bit `i` when `node[ i ]` is greater than the rhs values.
+ *
+ * \param lhs, rhs SIMD register, usually with the same value on all lanes
+ * \param node Array of NodeSize_T values
+ * \tparam NodeSize_T Number of values on the node, a multiple of simd_size up to 64
+ * \returns Bitmask with one bit for each value of the node
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/compare.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     int32_t node[ 16 ] = { 0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150 };
+ *     ls::t_int32_simd key( 95 );
+ *     std::cout << "greater_node_bitmask< 16 >( key, node ): " << std::hex
+ *               << ls::greater_node_bitmask< 16 >( key, node ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * greater_node_bitmask< 16 >( key, node ): 3ff
+ * ```
+ *
+ * \see greater_node_last_index, bit_count
+ */
+///@{
+template< size_t NodeSize_T, typename ValueType_T, typename Tag_T >
+inline uint64_t greater_node_bitmask( simd_type< ValueType_T, Tag_T > lhs, const ValueType_T* node )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    static_assert( NodeSize_T % simd::simd_size == 0 && NodeSize_T <= 64,
+                   "Node must have whole SIMD registers and at most 64 values" );
+
+    uint64_t bitmask = 0;
+    for( size_t i = 0; i < NodeSize_T; i += simd::simd_size )
+    {
+        bitmask |= static_cast< uint64_t >( mask_to_lane_bitmask< ValueType_T, Tag_T >(
+                        greater< ValueType_T, Tag_T >( lhs, load< ValueType_T, Tag_T >( node + i ) ) ) ) << i;
+    }
+    return bitmask;
+}
+
+template< size_t NodeSize_T, typename ValueType_T, typename Tag_T >
+inline uint64_t greater_node_bitmask( const ValueType_T* node, simd_type< ValueType_T, Tag_T > rhs )
+{
+    using simd = simd_type< ValueType_T, Tag_T >;
+    static_assert( NodeSize_T % simd::simd_size == 0 && NodeSize_T <= 64,
+                   "Node must have whole SIMD registers and at most 64 values" );
+
+    uint64_t bitmask = 0;
+    for( size_t i = 0; i < NodeSize_T; i += simd::simd_size )
+    {
+        bitmask |= static_cast< uint64_t >( mask_to_lane_bitmask< ValueType_T, Tag_T >(
+                        greater< ValueType_T, Tag_T >( load< ValueType_T, Tag_T >( node + i ), rhs ) ) ) << i;
+    }
+    return bitmask;
+}
+///@}
+
+/**
+ * \ingroup compare
+ * \brief Returns the index of the last value of the node which the lhs values are greater than
+ *
+ * This is greater_last_index lifted to a node of several SIMD registers. On a sorted
+ * node, the index plus one is the number of values less than lhs, which is the child
+ * to follow on a search tree.
+ *
+ * \param lhs SIMD register, usually with the same value on all lanes
+ * \param node Array of NodeSize_T values
+ * \tparam NodeSize_T Number of values on the node, a multiple of simd_size up to 64
+ * \returns Index of the last value of the node less than lhs, or -1 if none
+ *
+ * \see greater_node_bitmask, greater_last_index
+ */
+template< size_t NodeSize_T, typename ValueType_T, typename Tag_T >
+inline int greater_node_last_index( simd_type< ValueType_T, Tag_T > lhs, const ValueType_T* node )
+{
+    return bit_scan_reverse< Tag_T >( greater_node_bitmask< NodeSize_T >( lhs, node ) ).first;
+}
+
 // Equals
 // ---------------------------------------------------------------------------------------
 DEFINE_BINARY_FUNCTION_ADAPTORS( equal_to, type )
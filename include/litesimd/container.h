@@ -0,0 +1,48 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_H
+#define LITESIMD_CONTAINER_H
+
+#include <litesimd/types.h>
+
+#include <litesimd/container/btree_set.h>
+#include <litesimd/container/compressed_search_tree.h>
+#include <litesimd/container/concurrent_hash_map.h>
+#include <litesimd/container/eytzinger_array.h>
+#include <litesimd/container/flat_hash_map.h>
+#include <litesimd/container/flat_hash_set.h>
+#include <litesimd/container/learned_index.h>
+#include <litesimd/container/static_search_tree.h>
+#include <litesimd/container/static_search_tree_view.h>
+
+/**
+ * \defgroup container Container classes
+ *
+ * Container defines a collection of data structures which use the SIMD registers
+ * on their searches.
+ *
+ * All this classes are accessable at `<litesimd/container.h>` and depend on
+ * `boost::align`.
+ */
+
+#endif // LITESIMD_CONTAINER_H
@@ -0,0 +1,1002 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_BTREE_SET_H
+#define LITESIMD_CONTAINER_BTREE_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <boost/align/aligned_allocator.hpp>
+#include <litesimd/types.h>
+#include <litesimd/compare.h>
+#include <litesimd/container/search_range.h>
+#include <litesimd/container/detail/search_node.h>
+
+namespace litesimd {
+
+namespace detail {
+
+// Two cache lines of keys on each node, up to the 64 keys of the node bitmask
+template< typename Key_T >
+struct btree_node_size
+    : std::integral_constant< size_t, (128 / sizeof( Key_T ) < 64) ? 128 / sizeof( Key_T ) : 64 > {};
+
+// Leaves are linked on both directions for the iterators
+template< typename Key_T, size_t NodeSize_T >
+struct btree_leaf
+{
+    Key_T keys[ NodeSize_T ];
+    btree_leaf* prev;
+    btree_leaf* next;
+    size_t size;
+};
+
+// The key i is the separator of the children i and i + 1, all keys below the child i
+// are less than it and all keys below the child i + 1 are greater or equal to it
+template< typename Key_T, size_t NodeSize_T >
+struct btree_inner
+{
+    Key_T keys[ NodeSize_T ];
+    void* children[ NodeSize_T + 1 ];
+    size_t size;
+};
+
+} // namespace detail
+
+/**
+ * \ingroup container
+ * \brief Ordered set of unique keys on a B+tree searched with SIMD registers.
+ *
+ * The inner nodes and the leaves have two cache lines of keys (32 int32, 16 int64,
+ * ...), padded with the greatest key value, so the search on each node compares the
+ * key with all keys of the node at once with greater_node_bitmask. The leaves are
+ * linked and hold the keys in order, so iteration and range scans go through the
+ * leaves without going back to the inner nodes.
+ *
+ * The interface follows `std::set`: insert, erase, find, lower_bound, upper_bound,
+ * equal_range and bidirectional iterators. The range constructor and bulk_load build
+ * the tree bottom up, which is much faster than inserting the keys one by one.
+ *
+ * Unlike `std::set`, insert and erase move the keys between the nodes, so they
+ * invalidate all iterators.
+ *
+ * Signed and unsigned integers, float and double keys are supported.
+ *
+ * \tparam Key_T Key type
+ * \tparam Tag_T Instruction set used on the searches
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/container.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::btree_set< int32_t > set;
+ *     for( int32_t i = 0; i < 1000; ++i )
+ *         set.insert( (i * 7) % 1000 );
+ *     set.erase( 502 );
+ *
+ *     std::cout << "size: " << set.size() << std::endl << "range [500, 505):";
+ *     for( auto it = set.lower_bound( 500 ); it != set.lower_bound( 505 ); ++it )
+ *         std::cout << " " << *it;
+ *     std::cout << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * size: 999
+ * range [500, 505): 500 501 503 504
+ * ```
+ */
+template< typename Key_T, typename Tag_T = default_tag >
+class btree_set
+{
+    static_assert( detail::is_searchable< Key_T >::value,
+                   "btree_set supports only integer, float and double keys" );
+
+public:
+    /// Keys on each node of the tree
+    constexpr static size_t node_size = detail::btree_node_size< Key_T >::value;
+
+private:
+    using search_type = typename detail::search_traits< Key_T >::type;
+    using simd = simd_type< search_type, Tag_T >;
+    using is_unsigned = std::is_unsigned< Key_T >;
+    using leaf_type = detail::btree_leaf< Key_T, node_size >;
+    using inner_type = detail::btree_inner< Key_T, node_size >;
+
+    // Smaller nodes than this are merged with their siblings, but the root
+    constexpr static size_t min_size = node_size / 2;
+
+    // Even the smallest nodes have 9 children, so this is far more than 2^64 keys
+    constexpr static size_t max_height = 32;
+
+    struct path_entry
+    {
+        inner_type* node;
+        size_t child;
+    };
+
+public:
+    using key_type        = Key_T;
+    using value_type      = Key_T;
+    using size_type       = size_t;
+    using difference_type = ptrdiff_t;
+    using reference       = const Key_T&;
+    using const_reference = const Key_T&;
+
+    /// Bidirectional iterator over the keys in order
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = Key_T;
+        using difference_type   = ptrdiff_t;
+        using pointer           = const Key_T*;
+        using reference         = const Key_T&;
+
+        const_iterator() : leaf_( nullptr ), pos_( 0 ) {}
+
+        reference operator*() const { return leaf_->keys[ pos_ ]; }
+        pointer operator->() const { return &leaf_->keys[ pos_ ]; }
+
+        const_iterator& operator++()
+        {
+            if( ++pos_ == leaf_->size && leaf_->next != nullptr )
+            {
+                leaf_ = leaf_->next;
+                pos_ = 0;
+            }
+            return *this;
+        }
+
+        const_iterator operator++( int )
+        {
+            const_iterator ret( *this );
+            ++*this;
+            return ret;
+        }
+
+        const_iterator& operator--()
+        {
+            if( pos_ == 0 )
+            {
+                leaf_ = leaf_->prev;
+                pos_ = leaf_->size;
+            }
+            --pos_;
+            return *this;
+        }
+
+        const_iterator operator--( int )
+        {
+            const_iterator ret( *this );
+            --*this;
+            return ret;
+        }
+
+        bool operator==( const const_iterator& rhs ) const
+        {
+            return leaf_ == rhs.leaf_ && pos_ == rhs.pos_;
+        }
+
+        bool operator!=( const const_iterator& rhs ) const
+        {
+            return !(*this == rhs);
+        }
+
+    private:
+        friend class btree_set;
+
+        const_iterator( const leaf_type* leaf, size_t pos ) : leaf_( leaf ), pos_( pos ) {}
+
+        const leaf_type* leaf_;
+        size_t pos_;
+    };
+
+    using iterator = const_iterator;
+
+    /// SIMD register of the keys given to the range callback, the unsigned keys are
+    /// kept as they are on the signed register of the same size
+    using register_type = simd;
+
+    /// Forward iterator over the keys of a range, see range()
+    class range_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Key_T;
+        using difference_type   = ptrdiff_t;
+        using pointer           = const Key_T*;
+        using reference         = const Key_T&;
+
+        range_iterator() : leaf_( nullptr ), pos_( 0 ), limit_( 0 ) {}
+
+        reference operator*() const { return leaf_->keys[ pos_ ]; }
+        pointer operator->() const { return &leaf_->keys[ pos_ ]; }
+
+        range_iterator& operator++()
+        {
+            if( ++pos_ == limit_ )
+                next();
+            return *this;
+        }
+
+        range_iterator operator++( int )
+        {
+            range_iterator ret( *this );
+            ++*this;
+            return ret;
+        }
+
+        bool operator==( const range_iterator& rhs ) const
+        {
+            return leaf_ == rhs.leaf_ && pos_ == rhs.pos_;
+        }
+
+        bool operator!=( const range_iterator& rhs ) const
+        {
+            return !(*this == rhs);
+        }
+
+    private:
+        friend class btree_set;
+
+        range_iterator( const_iterator first, simd hi )
+            : leaf_( first.leaf_ ), pos_( first.pos_ ), limit_( first.pos_ ), hi_( hi )
+        {
+            next();
+        }
+
+        // Checks the keys from pos to the end of its register, the keys are sorted so
+        // the ones less than hi are the first ones
+        void next()
+        {
+            if( pos_ == leaf_->size )
+            {
+                leaf_ = leaf_->next;
+                pos_ = 0;
+            }
+            if( leaf_ != nullptr )
+            {
+                size_t reg = pos_ & ~(simd::simd_size - 1);
+                uint32_t mask = detail::search_less_lanes< Tag_T >( leaf_->keys + reg, hi_ ) >> (pos_ - reg);
+                limit_ = pos_ + bit_count< Tag_T >( mask );
+            }
+            if( leaf_ == nullptr || pos_ == limit_ )
+            {
+                leaf_ = nullptr;
+                pos_ = limit_ = 0;
+            }
+        }
+
+        const leaf_type* leaf_;
+        size_t pos_;
+        size_t limit_;
+        simd hi_;
+    };
+
+    /// Empty set
+    btree_set()
+        : root_( nullptr ), first_( nullptr ), last_( nullptr ), height_( 0 ), size_( 0 )
+    {
+        reset();
+    }
+
+    /**
+     * \brief Builds the set from a range of keys, in any order
+     *
+     * \param first, last Range of keys
+     */
+    template< typename Iterator_T >
+    btree_set( Iterator_T first, Iterator_T last )
+        : btree_set()
+    {
+        std::vector< Key_T > keys( first, last );
+        std::sort( keys.begin(), keys.end() );
+        bulk_load( keys.begin(), keys.end() );
+    }
+
+    btree_set( const btree_set& other )
+        : btree_set()
+    {
+        bulk_load( other.begin(), other.end() );
+    }
+
+    btree_set( btree_set&& other )
+        : btree_set()
+    {
+        swap( other );
+    }
+
+    btree_set& operator=( btree_set other )
+    {
+        swap( other );
+        return *this;
+    }
+
+    ~btree_set()
+    {
+        destroy( root_, height_ );
+    }
+
+    void swap( btree_set& other )
+    {
+        std::swap( root_, other.root_ );
+        std::swap( first_, other.first_ );
+        std::swap( last_, other.last_ );
+        std::swap( height_, other.height_ );
+        std::swap( size_, other.size_ );
+    }
+
+    /// Iterator to the first key
+    const_iterator begin() const { return const_iterator( first_, 0 ); }
+
+    /// Iterator past the last key
+    const_iterator end() const { return const_iterator( last_, last_->size ); }
+
+    /// Number of keys
+    size_t size() const { return size_; }
+
+    /// True when the set has no keys
+    bool empty() const { return size_ == 0; }
+
+    /// Levels of the tree, including the leaves
+    size_t height() const { return height_ + 1; }
+
+    /// Removes all keys
+    void clear()
+    {
+        destroy( root_, height_ );
+        reset();
+    }
+
+    /**
+     * \brief Replaces the keys of the set by the keys of a sorted range
+     *
+     * The leaves are filled in order and the inner levels are built over them, without
+     * searching or splitting nodes. Repeated keys are inserted once.
+     *
+     * \param first, last Sorted range of keys
+     */
+    template< typename Iterator_T >
+    void bulk_load( Iterator_T first, Iterator_T last )
+    {
+        std::vector< Key_T > keys;
+        for( ; first != last; ++first )
+        {
+            if( keys.empty() || keys.back() < *first )
+                keys.push_back( *first );
+        }
+
+        clear();
+        if( keys.empty() )
+            return;
+
+        // Leaves with the keys evenly distributed, all more than half full
+        free_leaf( first_ );
+        size_t nodes = (keys.size() + node_size - 1) / node_size;
+        std::vector< void* > level;
+        std::vector< Key_T > level_min;
+        leaf_type* prev = nullptr;
+        for( size_t i = 0; i < nodes; ++i )
+        {
+            size_t begin = keys.size() * i / nodes;
+            size_t end = keys.size() * (i + 1) / nodes;
+
+            leaf_type* leaf = new_leaf();
+            std::copy( keys.begin() + begin, keys.begin() + end, leaf->keys );
+            leaf->size = end - begin;
+            leaf->prev = prev;
+            if( prev != nullptr )
+                prev->next = leaf;
+            else
+                first_ = leaf;
+            prev = leaf;
+
+            level.push_back( leaf );
+            level_min.push_back( keys[ begin ] );
+        }
+        last_ = prev;
+
+        // Inner levels with the children evenly distributed, until the root
+        while( level.size() > 1 )
+        {
+            nodes = (level.size() + node_size) / (node_size + 1);
+            std::vector< void* > upper;
+            std::vector< Key_T > upper_min;
+            for( size_t i = 0; i < nodes; ++i )
+            {
+                size_t begin = level.size() * i / nodes;
+                size_t end = level.size() * (i + 1) / nodes;
+
+                inner_type* inner = new_inner();
+                std::copy( level.begin() + begin, level.begin() + end, inner->children );
+                std::copy( level_min.begin() + begin + 1, level_min.begin() + end, inner->keys );
+                inner->size = end - begin - 1;
+
+                upper.push_back( inner );
+                upper_min.push_back( level_min[ begin ] );
+            }
+            level.swap( upper );
+            level_min.swap( upper_min );
+            ++height_;
+        }
+
+        root_ = level.front();
+        size_ = keys.size();
+    }
+
+    /**
+     * \brief Inserts a key
+     *
+     * \param key Key to insert
+     * \returns Pair with the iterator to the key and true when it was inserted, or false
+     * when the key was already on the set
+     */
+    std::pair< const_iterator, bool > insert( const Key_T& key )
+    {
+        path_entry path[ max_height ];
+        simd key_vec( detail::search_traits< Key_T >::to( key ) );
+        leaf_type* leaf = find_leaf( key_vec, path );
+        size_t pos = node_count< false >( leaf->keys, leaf->size, key_vec );
+
+        if( pos < leaf->size && !(key < leaf->keys[ pos ]) )
+            return std::make_pair( const_iterator( leaf, pos ), false );
+
+        ++size_;
+        if( leaf->size < node_size )
+        {
+            std::copy_backward( leaf->keys + pos, leaf->keys + leaf->size, leaf->keys + leaf->size + 1 );
+            leaf->keys[ pos ] = key;
+            ++leaf->size;
+            return std::make_pair( const_iterator( leaf, pos ), true );
+        }
+
+        // Full leaf, half of the keys go to a new leaf at its right
+        Key_T keys[ node_size + 1 ];
+        std::copy( leaf->keys, leaf->keys + pos, keys );
+        keys[ pos ] = key;
+        std::copy( leaf->keys + pos, leaf->keys + node_size, keys + pos + 1 );
+
+        constexpr size_t left_size = (node_size + 1) / 2;
+        leaf_type* right = new_leaf();
+        std::copy( keys, keys + left_size, leaf->keys );
+        std::fill( leaf->keys + left_size, leaf->keys + node_size, detail::search_node_pad< Key_T >() );
+        leaf->size = left_size;
+        std::copy( keys + left_size, keys + node_size + 1, right->keys );
+        right->size = node_size + 1 - left_size;
+
+        right->prev = leaf;
+        right->next = leaf->next;
+        if( right->next != nullptr )
+            right->next->prev = right;
+        else
+            last_ = right;
+        leaf->next = right;
+
+        insert_child( path, right->keys[ 0 ], right );
+        return std::make_pair( pos < left_size ? const_iterator( leaf, pos )
+                                               : const_iterator( right, pos - left_size ), true );
+    }
+
+    /**
+     * \brief Inserts the keys of a range
+     *
+     * \param first, last Range of keys
+     */
+    template< typename Iterator_T >
+    void insert( Iterator_T first, Iterator_T last )
+    {
+        for( ; first != last; ++first )
+            insert( *first );
+    }
+
+    /**
+     * \brief Removes a key
+     *
+     * \param key Key to remove
+     * \returns Number of keys removed, 0 or 1
+     */
+    size_t erase( const Key_T& key )
+    {
+        path_entry path[ max_height ];
+        simd key_vec( detail::search_traits< Key_T >::to( key ) );
+        leaf_type* leaf = find_leaf( key_vec, path );
+        size_t pos = node_count< false >( leaf->keys, leaf->size, key_vec );
+
+        if( pos == leaf->size || key < leaf->keys[ pos ] )
+            return 0;
+
+        --size_;
+        std::copy( leaf->keys + pos + 1, leaf->keys + leaf->size, leaf->keys + pos );
+        leaf->keys[ --leaf->size ] = detail::search_node_pad< Key_T >();
+
+        if( height_ > 0 && leaf->size < min_size )
+            rebalance_leaf( path, leaf );
+        return 1;
+    }
+
+    /**
+     * \brief Removes the key at the position
+     *
+     * \param pos Iterator to the key to remove
+     * \returns Iterator to the key after the removed one
+     */
+    const_iterator erase( const_iterator pos )
+    {
+        Key_T key = *pos;
+        erase( key );
+        return upper_bound( key );
+    }
+
+    /**
+     * \brief Returns the first key not less than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key not less than key, or end()
+     */
+    const_iterator lower_bound( const Key_T& key ) const
+    {
+        return bound< false >( key );
+    }
+
+    /**
+     * \brief Returns the first key greater than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key greater than key, or end()
+     */
+    const_iterator upper_bound( const Key_T& key ) const
+    {
+        return bound< true >( key );
+    }
+
+    /**
+     * \brief Returns the range with the key
+     *
+     * \param key Key to search
+     * \returns Pair with the lower_bound and the upper_bound of the key
+     */
+    std::pair< const_iterator, const_iterator > equal_range( const Key_T& key ) const
+    {
+        const_iterator it = find( key );
+        if( it == end() )
+            return std::make_pair( lower_bound( key ), lower_bound( key ) );
+        return std::make_pair( it, std::next( it ) );
+    }
+
+    /**
+     * \brief Finds a key
+     *
+     * \param key Key to search
+     * \returns Iterator to the key, or end() when not found
+     */
+    const_iterator find( const Key_T& key ) const
+    {
+        simd key_vec( detail::search_traits< Key_T >::to( key ) );
+        const leaf_type* leaf = find_leaf( key_vec, nullptr );
+        size_t pos = node_count< false >( leaf->keys, leaf->size, key_vec );
+        return (pos < leaf->size && !(key < leaf->keys[ pos ])) ? const_iterator( leaf, pos ) : end();
+    }
+
+    /**
+     * \brief Checks if the set has the key
+     *
+     * \param key Key to search
+     * \returns True when the key was found
+     */
+    bool contains( const Key_T& key ) const
+    {
+        return find( key ) != end();
+    }
+
+    /**
+     * \brief Number of keys equal to key
+     *
+     * \param key Key to search
+     * \returns 1 when the key was found, 0 otherwise
+     */
+    size_t count( const Key_T& key ) const
+    {
+        return contains( key ) ? 1 : 0;
+    }
+
+    /**
+     * \brief Lazy range of the keys in [lo, hi)
+     *
+     * The tree is descended once for lo. The iterators compare the following keys with
+     * hi one SIMD register at a time, only when they get to that register, going
+     * through the linked leaves.
+     *
+     * \param lo, hi Bounds of the range, hi is not included
+     * \returns Range with the keys not less than lo and less than hi
+     */
+    search_range< range_iterator > range( const Key_T& lo, const Key_T& hi ) const
+    {
+        return search_range< range_iterator >( range_iterator( lower_bound( lo ),
+                                               simd( detail::search_traits< Key_T >::to( hi ) ) ) );
+    }
+
+    /**
+     * \brief Calls the function for each SIMD register of keys with keys in [lo, hi)
+     *
+     * The tree is descended once for lo and the following registers of the leaves are
+     * compared with hi until the first key not less than hi. The function receives
+     * each register and the lane bitmask of its keys inside the range, the bit `i` set
+     * for the key of index `i`.
+     *
+     * \param lo, hi Bounds of the range, hi is not included
+     * \param func Function called as `func( register_type keys, uint32_t bitmask )`
+     *
+     * **Example**
+     * ```{.cpp}
+     * // Number of keys in [lo, hi)
+     * size_t count = 0;
+     * set.range( lo, hi, [&]( decltype( set )::register_type, uint32_t bitmask ){
+     *     count += ls::bit_count( bitmask );
+     * });
+     * ```
+     */
+    template< typename Function_T >
+    void range( const Key_T& lo, const Key_T& hi, Function_T func ) const
+    {
+        const_iterator first = lower_bound( lo );
+        const leaf_type* leaf = first.leaf_;
+        if( first.pos_ == leaf->size )
+            return;
+
+        simd hi_vec( detail::search_traits< Key_T >::to( hi ) );
+        size_t reg = first.pos_ & ~(simd::simd_size - 1);
+        uint32_t mask = detail::search_less_lanes< Tag_T >( leaf->keys + reg, hi_vec ) & (~0u << (first.pos_ - reg));
+        while( mask != 0 )
+        {
+            func( load< search_type, Tag_T >( reinterpret_cast< const search_type* >( leaf->keys + reg ) ), mask );
+
+            // Stops on the first key of the leaf not in the range, the padding after the
+            // last key of the leaf is never in the range
+            size_t last = std::min( reg + simd::simd_size, leaf->size ) - 1;
+            if( (mask >> (last - reg)) == 0 )
+                return;
+            reg += simd::simd_size;
+            if( reg >= leaf->size )
+            {
+                leaf = leaf->next;
+                reg = 0;
+                if( leaf == nullptr )
+                    return;
+            }
+            mask = detail::search_less_lanes< Tag_T >( leaf->keys + reg, hi_vec );
+        }
+    }
+
+private:
+    using leaf_allocator = boost::alignment::aligned_allocator< leaf_type, 64 >;
+    using inner_allocator = boost::alignment::aligned_allocator< inner_type, 64 >;
+
+    void* root_;
+    leaf_type* first_;
+    leaf_type* last_;
+    size_t height_; // Levels of inner nodes
+    size_t size_;
+
+    // Number of keys of the node before the bound, the padding is never counted
+    template< bool Upper_T >
+    static size_t node_count( const Key_T* keys, size_t size, simd key_vec )
+    {
+        return std::min( detail::search_key_count< Tag_T, node_size, Upper_T >( keys, key_vec, is_unsigned() ),
+                         size );
+    }
+
+    leaf_type* find_leaf( simd key_vec, path_entry* path ) const
+    {
+        void* node = root_;
+        for( size_t l = 0; l < height_; ++l )
+        {
+            inner_type* inner = static_cast< inner_type* >( node );
+            size_t child = node_count< true >( inner->keys, inner->size, key_vec );
+            if( path != nullptr )
+            {
+                path[ l ].node = inner;
+                path[ l ].child = child;
+            }
+            node = inner->children[ child ];
+        }
+        return static_cast< leaf_type* >( node );
+    }
+
+    // The key is on the leaf of the descent or it is the first key of the next leaf
+    template< bool Upper_T >
+    const_iterator bound( const Key_T& key ) const
+    {
+        simd key_vec( detail::search_traits< Key_T >::to( key ) );
+        const leaf_type* leaf = find_leaf( key_vec, nullptr );
+        size_t pos = node_count< Upper_T >( leaf->keys, leaf->size, key_vec );
+        if( pos == leaf->size && leaf->next != nullptr )
+            return const_iterator( leaf->next, 0 );
+        return const_iterator( leaf, pos );
+    }
+
+    // Inserts the separator and the new node at the right of the child of the path,
+    // splitting the full inner nodes up to the root
+    void insert_child( path_entry* path, Key_T key, void* child )
+    {
+        for( size_t l = height_; l-- > 0; )
+        {
+            inner_type* inner = path[ l ].node;
+            size_t pos = path[ l ].child;
+            if( inner->size < node_size )
+            {
+                std::copy_backward( inner->keys + pos, inner->keys + inner->size,
+                                    inner->keys + inner->size + 1 );
+                std::copy_backward( inner->children + pos + 1, inner->children + inner->size + 1,
+                                    inner->children + inner->size + 2 );
+                inner->keys[ pos ] = key;
+                inner->children[ pos + 1 ] = child;
+                ++inner->size;
+                return;
+            }
+
+            Key_T keys[ node_size + 1 ];
+            void* children[ node_size + 2 ];
+            std::copy( inner->keys, inner->keys + pos, keys );
+            keys[ pos ] = key;
+            std::copy( inner->keys + pos, inner->keys + node_size, keys + pos + 1 );
+            std::copy( inner->children, inner->children + pos + 1, children );
+            children[ pos + 1 ] = child;
+            std::copy( inner->children + pos + 1, inner->children + node_size + 1, children + pos + 2 );
+
+            // The middle key goes up as the separator of the two halves
+            constexpr size_t left_size = (node_size + 1) / 2;
+            inner_type* right = new_inner();
+            std::copy( keys, keys + left_size, inner->keys );
+            std::fill( inner->keys + left_size, inner->keys + node_size, detail::search_node_pad< Key_T >() );
+            std::copy( children, children + left_size + 1, inner->children );
+            inner->size = left_size;
+            std::copy( keys + left_size + 1, keys + node_size + 1, right->keys );
+            std::copy( children + left_size + 1, children + node_size + 2, right->children );
+            right->size = node_size - left_size;
+
+            key = keys[ left_size ];
+            child = right;
+        }
+
+        inner_type* root = new_inner();
+        root->keys[ 0 ] = key;
+        root->children[ 0 ] = root_;
+        root->children[ 1 ] = child;
+        root->size = 1;
+        root_ = root;
+        ++height_;
+    }
+
+    // Removes the key pos and the child at its right
+    static void remove_child( inner_type* inner, size_t pos )
+    {
+        std::copy( inner->keys + pos + 1, inner->keys + inner->size, inner->keys + pos );
+        std::copy( inner->children + pos + 2, inner->children + inner->size + 1, inner->children + pos + 1 );
+        inner->keys[ --inner->size ] = detail::search_node_pad< Key_T >();
+    }
+
+    // Borrows a key from a sibling or merges the leaf with it
+    void rebalance_leaf( path_entry* path, leaf_type* leaf )
+    {
+        inner_type* parent = path[ height_ - 1 ].node;
+        size_t pos = path[ height_ - 1 ].child;
+        leaf_type* left = pos > 0 ? static_cast< leaf_type* >( parent->children[ pos - 1 ] ) : nullptr;
+        leaf_type* right = pos < parent->size ? static_cast< leaf_type* >( parent->children[ pos + 1 ] ) : nullptr;
+
+        if( left != nullptr && left->size > min_size )
+        {
+            std::copy_backward( leaf->keys, leaf->keys + leaf->size, leaf->keys + leaf->size + 1 );
+            leaf->keys[ 0 ] = left->keys[ --left->size ];
+            left->keys[ left->size ] = detail::search_node_pad< Key_T >();
+            ++leaf->size;
+            parent->keys[ pos - 1 ] = leaf->keys[ 0 ];
+            return;
+        }
+
+        if( right != nullptr && right->size > min_size )
+        {
+            leaf->keys[ leaf->size++ ] = right->keys[ 0 ];
+            std::copy( right->keys + 1, right->keys + right->size, right->keys );
+            right->keys[ --right->size ] = detail::search_node_pad< Key_T >();
+            parent->keys[ pos ] = right->keys[ 0 ];
+            return;
+        }
+
+        if( left != nullptr )
+        {
+            merge_leaves( left, leaf );
+            remove_child( parent, pos - 1 );
+        }
+        else
+        {
+            merge_leaves( leaf, right );
+            remove_child( parent, pos );
+        }
+        rebalance_inner( path, height_ - 1 );
+    }
+
+    // Moves the keys of the right leaf to the left one
+    void merge_leaves( leaf_type* left, leaf_type* right )
+    {
+        std::copy( right->keys, right->keys + right->size, left->keys + left->size );
+        left->size += right->size;
+        left->next = right->next;
+        if( left->next != nullptr )
+            left->next->prev = left;
+        else
+            last_ = left;
+        free_leaf( right );
+    }
+
+    // Borrows a child from a sibling or merges the inner nodes from the level up to the root
+    void rebalance_inner( path_entry* path, size_t level )
+    {
+        for( ;; --level )
+        {
+            inner_type* inner = path[ level ].node;
+            if( level == 0 )
+            {
+                // Root without keys, its only child is the new root
+                if( inner->size == 0 )
+                {
+                    root_ = inner->children[ 0 ];
+                    free_inner( inner );
+                    --height_;
+                }
+                return;
+            }
+
+            if( inner->size >= min_size )
+                return;
+
+            inner_type* parent = path[ level - 1 ].node;
+            size_t pos = path[ level - 1 ].child;
+            inner_type* left = pos > 0 ? static_cast< inner_type* >( parent->children[ pos - 1 ] ) : nullptr;
+            inner_type* right = pos < parent->size ? static_cast< inner_type* >( parent->children[ pos + 1 ] ) : nullptr;
+
+            if( left != nullptr && left->size > min_size )
+            {
+                std::copy_backward( inner->keys, inner->keys + inner->size, inner->keys + inner->size + 1 );
+                std::copy_backward( inner->children, inner->children + inner->size + 1,
+                                    inner->children + inner->size + 2 );
+                inner->keys[ 0 ] = parent->keys[ pos - 1 ];
+                inner->children[ 0 ] = left->children[ left->size ];
+                ++inner->size;
+                parent->keys[ pos - 1 ] = left->keys[ left->size - 1 ];
+                left->keys[ --left->size ] = detail::search_node_pad< Key_T >();
+                return;
+            }
+
+            if( right != nullptr && right->size > min_size )
+            {
+                inner->keys[ inner->size ] = parent->keys[ pos ];
+                inner->children[ inner->size + 1 ] = right->children[ 0 ];
+                ++inner->size;
+                parent->keys[ pos ] = right->keys[ 0 ];
+                std::copy( right->children + 1, right->children + right->size + 1, right->children );
+                remove_first_key( right );
+                return;
+            }
+
+            if( left != nullptr )
+            {
+                merge_inner( left, parent->keys[ pos - 1 ], inner );
+                remove_child( parent, pos - 1 );
+            }
+            else
+            {
+                merge_inner( inner, parent->keys[ pos ], right );
+                remove_child( parent, pos );
+            }
+        }
+    }
+
+    static void remove_first_key( inner_type* inner )
+    {
+        std::copy( inner->keys + 1, inner->keys + inner->size, inner->keys );
+        inner->keys[ --inner->size ] = detail::search_node_pad< Key_T >();
+    }
+
+    // Moves the separator and the keys and children of the right node to the left one
+    void merge_inner( inner_type* left, const Key_T& key, inner_type* right )
+    {
+        left->keys[ left->size ] = key;
+        std::copy( right->keys, right->keys + right->size, left->keys + left->size + 1 );
+        std::copy( right->children, right->children + right->size + 1, left->children + left->size + 1 );
+        left->size += right->size + 1;
+        free_inner( right );
+    }
+
+    leaf_type* new_leaf()
+    {
+        leaf_allocator alloc;
+        leaf_type* leaf = alloc.allocate( 1 );
+        std::fill( leaf->keys, leaf->keys + node_size, detail::search_node_pad< Key_T >() );
+        leaf->prev = nullptr;
+        leaf->next = nullptr;
+        leaf->size = 0;
+        return leaf;
+    }
+
+    inner_type* new_inner()
+    {
+        inner_allocator alloc;
+        inner_type* inner = alloc.allocate( 1 );
+        std::fill( inner->keys, inner->keys + node_size, detail::search_node_pad< Key_T >() );
+        std::fill( inner->children, inner->children + node_size + 1, nullptr );
+        inner->size = 0;
+        return inner;
+    }
+
+    void free_leaf( leaf_type* leaf )
+    {
+        leaf_allocator().deallocate( leaf, 1 );
+    }
+
+    void free_inner( inner_type* inner )
+    {
+        inner_allocator().deallocate( inner, 1 );
+    }
+
+    void destroy( void* node, size_t level )
+    {
+        if( level == 0 )
+        {
+            free_leaf( static_cast< leaf_type* >( node ) );
+            return;
+        }
+
+        inner_type* inner = static_cast< inner_type* >( node );
+        for( size_t i = 0; i <= inner->size; ++i )
+            destroy( inner->children[ i ], level - 1 );
+        free_inner( inner );
+    }
+
+    // Empty tree with only one leaf
+    void reset()
+    {
+        first_ = last_ = new_leaf();
+        root_ = first_;
+        height_ = 0;
+        size_ = 0;
+    }
+};
+
+template< typename Key_T, typename Tag_T >
+constexpr size_t btree_set< Key_T, Tag_T >::node_size;
+
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_BTREE_SET_H
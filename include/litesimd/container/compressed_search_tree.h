@@ -0,0 +1,399 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_COMPRESSED_SEARCH_TREE_H
+#define LITESIMD_CONTAINER_COMPRESSED_SEARCH_TREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/compare.h>
+#include <litesimd/algorithm/binary_search.h>
+#include <litesimd/helpers/containers.h>
+#include <litesimd/container/static_search_tree.h>
+#include <litesimd/container/detail/search_node.h>
+
+namespace litesimd {
+
+namespace detail {
+
+// Inner node of the compressed tree, one cache line with the separators coded as 16 bits
+// deltas from the base, the first key below the node, shifted right until the last one fits
+template< typename SearchType_T >
+struct compressed_search_node
+{
+    constexpr static size_t size = (search_tree_node_bytes - sizeof( SearchType_T )
+                                    - sizeof( uint16_t )) / sizeof( int16_t );
+
+    // The codes go from 0 to max_code and are stored minus code_bias, as the SIMD
+    // registers compare signed values
+    constexpr static int32_t max_code = 0xfffe;
+    constexpr static int32_t code_bias = 0x7fff;
+
+    int16_t codes[ size ];
+    uint16_t shift;
+    SearchType_T base;
+};
+
+} // namespace detail
+
+/**
+ * \ingroup container
+ * \brief Read only sorted set of integer keys indexed by a SIMD search tree with
+ * compressed inner nodes.
+ *
+ * Like static_search_tree, but each inner node keeps its separators coded on 16 bits:
+ * the delta from the first key below the node, shifted right until the last separator
+ * fits. So one cache line has 29 separators of int32 keys, or 27 of int64 keys, instead
+ * of 16 or 8, and the inner levels are two (int32) to three (int64) times smaller,
+ * staying longer on the L1 and L2 caches. One AVX2 register compares 16 separators at
+ * once. On the other hand each node takes a few more instructions to code the key, so
+ * the compressed tree is faster only when the inner levels of static_search_tree do
+ * not fit on the caches, see the nway_tree sample.
+ *
+ * The codes are rounded down, so a separator with a code less than the key code is
+ * less than the key and one with a greater code is greater than the key. Only on the
+ * separators with the same code of the key the search reads the full separators,
+ * kept on a separated array, which on uniform keys happens on less than 0.1% of the
+ * nodes. On the level above the leaves, where the exact keys of the search are often
+ * the separators, the ties are not solved: the search goes to the leftmost leaf the
+ * key may be and verifies it with the full keys, moving to the next leaves only when
+ * all keys of the leaf are less than the key and the first key of the next leaf is too.
+ *
+ * Signed and unsigned integers of 32 and 64 bits are supported. Repeated keys are
+ * allowed.
+ *
+ * \tparam Key_T Key type
+ * \tparam Tag_T Instruction set used on the searches
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/container.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values;
+ *     for( int32_t i = 0; i < 100000; ++i )
+ *         values.push_back( i * 2 );
+ *
+ *     ls::compressed_search_tree< int32_t > tree( values.begin(), values.end() );
+ *
+ *     auto it = tree.lower_bound( 501 );
+ *     std::cout << "lower_bound( 501 ): " << *it << " at " << (it - tree.begin()) << std::endl
+ *               << "contains( 502 ): " << tree.contains( 502 ) << std::endl
+ *               << "contains( 503 ): " << tree.contains( 503 ) << std::endl
+ *               << "height(): " << tree.height() << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * lower_bound( 501 ): 502 at 251
+ * contains( 502 ): 1
+ * contains( 503 ): 0
+ * height(): 4
+ * ```
+ */
+template< typename Key_T, typename Tag_T = default_tag >
+class compressed_search_tree
+{
+    static_assert( std::is_integral< Key_T >::value && sizeof( Key_T ) >= sizeof( int32_t ),
+                   "compressed_search_tree supports only 32 and 64 bits integer keys" );
+
+    using traits = detail::search_traits< Key_T >;
+    using search_type = typename traits::type;
+    using unsigned_type = typename traits::unsigned_type;
+    using simd = simd_type< search_type, Tag_T >;
+    using code_simd = simd_type< int16_t, Tag_T >;
+    using node_type = detail::compressed_search_node< search_type >;
+
+    static_assert( sizeof( node_type ) == detail::search_tree_node_bytes,
+                   "compressed_search_tree node must have one cache line" );
+
+public:
+    using key_type        = Key_T;
+    using value_type      = Key_T;
+    using size_type       = size_t;
+    using const_reference = const Key_T&;
+    using const_iterator  = const Key_T*;
+    using iterator        = const_iterator;
+
+    /// Keys on each leaf of the tree
+    constexpr static size_t leaf_size = detail::search_tree_node_bytes / sizeof( Key_T );
+
+    /// Separators on each inner node of the tree
+    constexpr static size_t inner_size = node_type::size;
+
+    /// Empty tree
+    compressed_search_tree() : size_( 0 ), leaves_( 0 ) {}
+
+    /**
+     * \brief Builds the tree from a sorted range
+     *
+     * \param first, last Sorted range of keys
+     */
+    template< typename Iterator_T >
+    compressed_search_tree( Iterator_T first, Iterator_T last )
+        : size_( 0 ), leaves_( 0 )
+    {
+        build( first, last );
+    }
+
+    /// Iterator to the first key
+    const_iterator begin() const { return keys_.data(); }
+
+    /// Iterator past the last key
+    const_iterator end() const { return begin() + size_; }
+
+    /// Number of keys
+    size_t size() const { return size_; }
+
+    /// True when the tree has no keys
+    bool empty() const { return size_ == 0; }
+
+    /// Levels of the tree, including the leaves
+    size_t height() const { return empty() ? 0 : levels_.size() + 1; }
+
+    /**
+     * \brief Returns the first key not less than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key not less than key, or end()
+     */
+    const_iterator lower_bound( const Key_T& key ) const
+    {
+        return bound< false >( key );
+    }
+
+    /**
+     * \brief Returns the first key greater than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key greater than key, or end()
+     */
+    const_iterator upper_bound( const Key_T& key ) const
+    {
+        return bound< true >( key );
+    }
+
+    /**
+     * \brief Finds a key equal to key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key equal to key, or end() when not found
+     */
+    const_iterator find( const Key_T& key ) const
+    {
+        const_iterator it = lower_bound( key );
+        return (it != end() && !(key < *it)) ? it : end();
+    }
+
+    /**
+     * \brief Checks if the tree has a key equal to key
+     *
+     * \param key Key to search
+     * \returns True when the key was found
+     */
+    bool contains( const Key_T& key ) const
+    {
+        return find( key ) != end();
+    }
+
+private:
+    struct tree_level
+    {
+        size_t offset; // First node of the level on nodes_
+        size_t nodes;  // Number of nodes of the level
+    };
+
+    size_t size_;
+    size_t leaves_;
+    std::vector< tree_level > levels_;
+    vector< node_type > nodes_;
+    std::vector< search_type > separators_;
+    vector< Key_T > keys_;
+
+    // Number of separators of the node before the bound of the key. Without Ties_T the
+    // separators with the same code of the key are not counted.
+    template< bool Upper_T, bool Ties_T >
+    size_t node_count( size_t index, search_type key ) const
+    {
+        const node_type& node = nodes_[ index ];
+
+        // The keys which get to the node are never less than its base
+        int32_t code = static_cast< int32_t >( std::min< unsigned_type >(
+                            (static_cast< unsigned_type >( key ) - static_cast< unsigned_type >( node.base ))
+                                >> node.shift, node_type::max_code ) ) - node_type::code_bias;
+
+        // Compares the whole cache line, the bits of shift and base are dropped
+        constexpr uint64_t valid = (UINT64_C( 1 ) << inner_size) - 1;
+        size_t count = bit_count< Tag_T >( valid & greater_node_bitmask< detail::search_tree_node_bytes / sizeof( int16_t ) >(
+                            code_simd( static_cast< int16_t >( code ) ), reinterpret_cast< const int16_t* >( &node ) ) );
+
+        // The next separators with the same code of the key are checked on the full separators
+        const search_type* separators = separators_.data() + index * inner_size;
+        while( Ties_T && count < inner_size && node.codes[ count ] == code &&
+               (Upper_T ? !(key < separators[ count ]) : (separators[ count ] < key)) )
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    template< bool Upper_T >
+    const_iterator bound( const Key_T& key ) const
+    {
+        if( empty() )
+            return end();
+
+        // The bases of the leftmost nodes are the first key
+        search_type search_key = traits::to( key );
+        if( search_key < traits::to( keys_.front() ) )
+            return begin();
+
+        size_t node = 0;
+        for( size_t l = 0; l + 1 < levels_.size(); ++l )
+        {
+            node = node * (inner_size + 1) + node_count< Upper_T, true >( levels_[ l ].offset + node, search_key );
+
+            // Only the padding separators lead to missing children, so the key is past all keys
+            if( node >= levels_[ l + 1 ].nodes )
+                return end();
+        }
+
+        // On the level above the leaves the ties lead to the leftmost leaf they may be, the
+        // first keys of the next leaves verify them
+        if( !levels_.empty() )
+            node = node * (inner_size + 1) + node_count< Upper_T, false >( levels_.back().offset + node, search_key );
+
+        simd key_vec( search_key );
+        size_t pos = leaf_count< Upper_T >( node, key_vec );
+        while( pos == leaf_size && node + 1 < leaves_ &&
+               (Upper_T ? !(search_key < traits::to( keys_[ (node + 1) * leaf_size ] ))
+                        : (traits::to( keys_[ (node + 1) * leaf_size ] ) < search_key)) )
+        {
+            pos = leaf_count< Upper_T >( ++node, key_vec );
+        }
+        return begin() + std::min( node * leaf_size + pos, size_ );
+    }
+
+    template< bool Upper_T >
+    size_t leaf_count( size_t leaf, simd key ) const
+    {
+        return detail::search_key_count< Tag_T, leaf_size, Upper_T >(
+                    begin() + leaf * leaf_size, key, std::is_unsigned< Key_T >() );
+    }
+
+    // Codes the count first separators, the others are padding never less than any key
+    static void encode( node_type& node, search_type base, const search_type* separators, size_t count )
+    {
+        node.base = base;
+        unsigned_type range = (count > 0) ? static_cast< unsigned_type >( separators[ count - 1 ] )
+                                            - static_cast< unsigned_type >( base ) : 0;
+        node.shift = 0;
+        while( (range >> node.shift) > static_cast< unsigned_type >( node_type::max_code ) )
+            ++node.shift;
+
+        for( size_t i = 0; i < inner_size; ++i )
+        {
+            int32_t code = (i < count) ? static_cast< int32_t >(
+                                (static_cast< unsigned_type >( separators[ i ] )
+                                 - static_cast< unsigned_type >( node.base )) >> node.shift )
+                                       : node_type::max_code;
+            node.codes[ i ] = static_cast< int16_t >( code - node_type::code_bias );
+        }
+    }
+
+    template< typename Iterator_T >
+    void build( Iterator_T first, Iterator_T last )
+    {
+        size_ = static_cast< size_t >( std::distance( first, last ) );
+        if( size_ == 0 )
+            return;
+
+        // Nodes of each level, from the leaves to the root
+        std::vector< size_t > nodes( 1, (size_ + leaf_size - 1) / leaf_size );
+        while( nodes.back() > 1 )
+            nodes.push_back( (nodes.back() + inner_size) / (inner_size + 1) );
+
+        leaves_ = nodes.front();
+        keys_.assign( leaves_ * leaf_size, detail::search_node_pad< Key_T >() );
+        std::copy( first, last, keys_.begin() );
+
+        levels_.resize( nodes.size() - 1 );
+        size_t offset = 0;
+        for( size_t l = 0; l < levels_.size(); ++l )
+        {
+            levels_[ l ].offset = offset;
+            levels_[ l ].nodes = nodes[ nodes.size() - l - 1 ];
+            offset += levels_[ l ].nodes;
+        }
+        nodes_.resize( offset );
+
+        // The level above the leaves has its ties verified on the leaves
+        separators_.assign( (levels_.empty() ? 0 : levels_.back().offset) * inner_size,
+                            std::numeric_limits< search_type >::max() );
+
+        // The separator i of the node n is the first key below its child (n * (inner_size + 1) + i + 1),
+        // that is the first key of the leaf (n * (inner_size + 1) + i + 1) * (inner_size + 1)^depth
+        size_t leaves_per_child = 1;
+        for( size_t l = levels_.size(); l-- > 0; )
+        {
+            for( size_t n = 0; n < levels_[ l ].nodes; ++n )
+            {
+                size_t index = levels_[ l ].offset + n;
+                search_type separators[ inner_size ];
+                size_t count = 0;
+                for( size_t i = 0; i < inner_size; ++i )
+                {
+                    size_t leaf = (n * (inner_size + 1) + i + 1) * leaves_per_child;
+                    if( leaf * leaf_size < size_ )
+                        separators[ count++ ] = traits::to( keys_[ leaf * leaf_size ] );
+                }
+                size_t first = n * (inner_size + 1) * leaves_per_child;
+                encode( nodes_[ index ], traits::to( keys_[ first * leaf_size ] ), separators, count );
+                if( l + 1 < levels_.size() )
+                    std::copy( separators, separators + count, separators_.begin() + index * inner_size );
+            }
+            leaves_per_child *= inner_size + 1;
+        }
+    }
+};
+
+template< typename Key_T, typename Tag_T >
+constexpr size_t compressed_search_tree< Key_T, Tag_T >::leaf_size;
+
+template< typename Key_T, typename Tag_T >
+constexpr size_t compressed_search_tree< Key_T, Tag_T >::inner_size;
+
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_COMPRESSED_SEARCH_TREE_H
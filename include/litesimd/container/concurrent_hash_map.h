@@ -0,0 +1,565 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_CONCURRENT_HASH_MAP_H
+#define LITESIMD_CONTAINER_CONCURRENT_HASH_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/algorithm/for_each.h>
+#include <litesimd/helpers/containers.h>
+#include <litesimd/container/detail/hash_table.h>
+
+namespace litesimd {
+
+namespace detail {
+
+// Group of slots of the concurrent table. The sequence is odd while a writer changes
+// the group, the readers retry when it is odd or changed during their read.
+template< typename Key_T, typename Mapped_T, size_t GroupSize_T >
+struct alignas( 64 ) concurrent_hash_group
+{
+    concurrent_hash_group() : seq( 0 )
+    {
+        std::fill( ctrl, ctrl + GroupSize_T, hash_ctrl_empty );
+    }
+
+    std::atomic< uint32_t > seq;
+    alignas( GroupSize_T ) int8_t ctrl[ GroupSize_T ];
+    Key_T keys[ GroupSize_T ];
+    Mapped_T values[ GroupSize_T ];
+};
+
+} // namespace detail
+
+/**
+ * \ingroup container
+ * \brief Hash map for many reader threads and few writer threads, where the readers
+ * never lock.
+ *
+ * The slots are split on groups of one SIMD register of control bytes, as on
+ * flat_hash_map, and each group has a sequence lock. A reader loads the control bytes
+ * of the group, matches the tag of the key with equal_to_bitmask, copies the value of
+ * the matching key and checks that the sequence of the group did not change, retrying
+ * the group otherwise. The readers do not write on the shared memory, so they scale
+ * with the cores on read mostly tables.
+ *
+ * The writers are serialized by a mutex and make the changes of each group inside its
+ * sequence lock, so a table with a high rate of writes does not scale. The table grows
+ * incrementally: when it is full, a larger table is allocated and each write moves
+ * 16 groups of the old table to the new one. While the groups are moved the readers
+ * search the new table and then the old one.
+ *
+ * The readers may still be searching an old table after it was replaced, so the old
+ * tables are released only by reclaim(), called while no thread reads the map, or by
+ * the destructor. They take at most the memory of the current table.
+ *
+ * The keys and the mapped values are copied by the readers while a writer may be
+ * changing them, and the copy is dropped when the sequence changed, so both must be
+ * trivially copyable.
+ *
+ * \tparam Key_T Key type, trivially copyable
+ * \tparam Mapped_T Mapped value type, trivially copyable
+ * \tparam Hash_T Hash function object, the hash is mixed before splitting its bits
+ * \tparam KeyEqual_T Key comparison function object
+ * \tparam Tag_T Instruction set of the control byte groups
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <thread>
+ * #include <vector>
+ * #include <litesimd/container.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::concurrent_hash_map< int64_t, int64_t > sessions;
+ *     for( int64_t i = 0; i < 1000; ++i )
+ *         sessions.insert( i, i * 10 );
+ *
+ *     // Readers do not lock, while the main thread updates the table
+ *     std::vector< int64_t > sums( 4 );
+ *     std::vector< std::thread > readers;
+ *     for( size_t t = 0; t < sums.size(); ++t )
+ *     {
+ *         readers.emplace_back( [&sessions, &sums, t]()
+ *         {
+ *             int64_t value;
+ *             for( int64_t i = 0; i < 1000; ++i )
+ *                 sums[ t ] += sessions.find( i, value ) ? 1 : 0;
+ *         } );
+ *     }
+ *     sessions.insert_or_assign( 1000, 10000 );
+ *     sessions.erase( 1000 );
+ *     for( auto& reader : readers )
+ *         reader.join();
+ *
+ *     int64_t value = 0;
+ *     std::cout << "found: " << sums[ 0 ] << std::endl
+ *               << "find( 42 ): " << sessions.find( 42, value ) << " " << value << std::endl
+ *               << "size(): " << sessions.size() << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * found: 1000
+ * find( 42 ): 1 420
+ * size(): 1000
+ * ```
+ */
+template< typename Key_T, typename Mapped_T, typename Hash_T = std::hash< Key_T >,
+          typename KeyEqual_T = std::equal_to< Key_T >, typename Tag_T = default_tag >
+class concurrent_hash_map
+{
+    static_assert( std::is_trivially_copyable< Key_T >::value && std::is_trivially_copyable< Mapped_T >::value,
+                   "concurrent_hash_map supports only trivially copyable keys and values" );
+
+    using ctrl_simd = simd_type< int8_t, Tag_T >;
+
+public:
+    /// Slots on each group, one control byte per SIMD register lane
+    constexpr static size_t group_size = ctrl_simd::simd_size;
+
+    /// Groups moved from the old table to the new one on each write while growing
+    constexpr static size_t migrate_groups = 16;
+
+    using key_type    = Key_T;
+    using mapped_type = Mapped_T;
+    using size_type   = size_t;
+    using hasher      = Hash_T;
+    using key_equal   = KeyEqual_T;
+
+    /// Empty map
+    concurrent_hash_map() : migrated_( 0 ), size_( 0 )
+    {
+        table_.store( new table( 1 ), std::memory_order_relaxed );
+        old_.store( nullptr, std::memory_order_relaxed );
+    }
+
+    concurrent_hash_map( const concurrent_hash_map& ) = delete;
+    concurrent_hash_map& operator=( const concurrent_hash_map& ) = delete;
+
+    ~concurrent_hash_map()
+    {
+        reclaim();
+        delete old_.load( std::memory_order_relaxed );
+        delete table_.load( std::memory_order_relaxed );
+    }
+
+    /// Number of values
+    size_t size() const { return size_.load( std::memory_order_relaxed ); }
+
+    /// True when the map has no values
+    bool empty() const { return size() == 0; }
+
+    /// Number of slots of the current table
+    size_t capacity() const { return table_.load( std::memory_order_acquire )->capacity(); }
+
+    /**
+     * \brief Finds the key, copying its mapped value. Does not lock.
+     *
+     * \param key Key to search
+     * \param value Receives the mapped value when the key was found
+     * \returns True when the key was found
+     */
+    bool find( const Key_T& key, Mapped_T& value ) const
+    {
+        uint64_t hash = detail::hash_mix( Hash_T()( key ) );
+
+        // The old table is set before the new one, and cleared after all groups moved
+        const table* current = table_.load( std::memory_order_acquire );
+        const table* old = old_.load( std::memory_order_acquire );
+        return search( current, key, hash, &value ) ||
+               (old != nullptr && old != current && search( old, key, hash, &value ));
+    }
+
+    /**
+     * \brief Checks if the map has the key. Does not lock.
+     *
+     * \param key Key to search
+     * \returns True when the key was found
+     */
+    bool contains( const Key_T& key ) const
+    {
+        Mapped_T value;
+        return find( key, value );
+    }
+
+    /**
+     * \brief Inserts the key and the value, when the map does not have the key
+     *
+     * \param key Key to insert
+     * \param value Mapped value
+     * \returns True when the key was inserted
+     */
+    bool insert( const Key_T& key, const Mapped_T& value )
+    {
+        return write( key, value, false );
+    }
+
+    /**
+     * \brief Inserts the key and the value, or replaces the value of the key
+     *
+     * \param key Key to insert
+     * \param value Mapped value
+     * \returns True when the key was inserted, false when it was replaced
+     */
+    bool insert_or_assign( const Key_T& key, const Mapped_T& value )
+    {
+        return write( key, value, true );
+    }
+
+    /**
+     * \brief Removes the key
+     *
+     * \param key Key to remove
+     * \returns Number of values removed, 0 or 1
+     */
+    size_t erase( const Key_T& key )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        uint64_t hash = detail::hash_mix( Hash_T()( key ) );
+        migrate();
+
+        // The key may be on both tables while growing
+        table* current = table_.load( std::memory_order_relaxed );
+        table* old = old_.load( std::memory_order_relaxed );
+        bool found = erase_position( current, key, hash );
+        if( old != nullptr )
+            found = erase_position( old, key, hash ) || found;
+
+        if( !found )
+            return 0;
+
+        size_.store( size_.load( std::memory_order_relaxed ) - 1, std::memory_order_relaxed );
+        return 1;
+    }
+
+    /**
+     * \brief Releases the tables replaced by the growth
+     *
+     * Must be called only while no thread reads the map, for example between the
+     * phases of a batch job. The destructor also releases them.
+     */
+    void reclaim()
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        for( table* retired : retired_ )
+            delete retired;
+        retired_.clear();
+    }
+
+    /// Hash function object
+    hasher hash_function() const { return hasher(); }
+
+    /// Key comparison function object
+    key_equal key_eq() const { return key_equal(); }
+
+private:
+    using group_type = detail::concurrent_hash_group< Key_T, Mapped_T, group_size >;
+
+    struct table
+    {
+        explicit table( size_t size )
+            : groups( size ), group_mask( size - 1 ), growth_left( max_load( capacity() ) ) {}
+
+        size_t capacity() const { return groups.size() * group_size; }
+
+        vector< group_type > groups;
+        size_t group_mask;
+        size_t growth_left;   // Values inserted on empty slots before the growth
+    };
+
+    std::atomic< table* > table_;
+    std::atomic< table* > old_;   // Table being moved to table_
+    size_t migrated_;             // Groups of old_ already moved
+    std::vector< table* > retired_;
+    std::atomic< size_t > size_;
+    std::mutex mutex_;
+
+    static size_t max_load( size_t capacity )
+    {
+        return capacity - capacity / 8;
+    }
+
+    static size_t first_group( const table* tab, uint64_t hash )
+    {
+        return static_cast< size_t >( hash >> 7 ) & tab->group_mask;
+    }
+
+    // Lock free search. The keys and values are copied while a writer may change them,
+    // which the sequence check detects, so the copies of a changed group are dropped.
+    // The value is only written to the caller after a check that found the key.
+    static bool search( const table* tab, const Key_T& key, uint64_t hash, Mapped_T* value )
+    {
+        typename std::aligned_storage< sizeof( Mapped_T ), alignof( Mapped_T ) >::type copy;
+        ctrl_simd tag( static_cast< int8_t >( hash & 0x7f ) );
+        ctrl_simd empty( detail::hash_ctrl_empty );
+        size_t g = first_group( tab, hash );
+        for( size_t step = 1; ; ++step )
+        {
+            const group_type& group = tab->groups[ g ];
+            bool found = false;
+            bool has_empty = false;
+            uint32_t seq;
+            do
+            {
+                seq = group.seq.load( std::memory_order_acquire );
+                if( seq & 1 )
+                    continue;
+
+                ctrl_simd ctrl_vec = load< int8_t, Tag_T >( group.ctrl );
+                found = false;
+                auto compare = [&]( int index ) -> bool
+                {
+                    found = KeyEqual_T()( group.keys[ index ], key );
+                    if( found && value != nullptr )
+                        std::memcpy( &copy, &group.values[ index ], sizeof( Mapped_T ) );
+                    return !found;
+                };
+                for_each_index< int8_t, decltype( compare ), Tag_T >(
+                    equal_to_bitmask< int8_t, Tag_T >( ctrl_vec, tag ), compare );
+                has_empty = equal_to_bitmask< int8_t, Tag_T >( ctrl_vec, empty ) != 0;
+
+                std::atomic_thread_fence( std::memory_order_acquire );
+            }
+            while( (seq & 1) || group.seq.load( std::memory_order_relaxed ) != seq );
+
+            if( found )
+            {
+                if( value != nullptr )
+                    std::memcpy( value, &copy, sizeof( Mapped_T ) );
+                return true;
+            }
+            if( has_empty )
+                return false;
+
+            g = (g + step) & tab->group_mask;
+        }
+    }
+
+    // Slot of the key, or npos, by the writer
+    static size_t position( const table* tab, const Key_T& key, uint64_t hash )
+    {
+        ctrl_simd tag( static_cast< int8_t >( hash & 0x7f ) );
+        ctrl_simd empty( detail::hash_ctrl_empty );
+        size_t g = first_group( tab, hash );
+        for( size_t step = 1; ; ++step )
+        {
+            const group_type& group = tab->groups[ g ];
+            ctrl_simd ctrl_vec = load< int8_t, Tag_T >( group.ctrl );
+            size_t pos = npos;
+            auto compare = [&]( int index ) -> bool
+            {
+                bool found = KeyEqual_T()( group.keys[ index ], key );
+                pos = found ? g * group_size + index : npos;
+                return !found;
+            };
+            for_each_index< int8_t, decltype( compare ), Tag_T >(
+                equal_to_bitmask< int8_t, Tag_T >( ctrl_vec, tag ), compare );
+            if( pos != npos )
+                return pos;
+            if( equal_to_bitmask< int8_t, Tag_T >( ctrl_vec, empty ) != 0 )
+                return npos;
+
+            g = (g + step) & tab->group_mask;
+        }
+    }
+
+    // First empty or deleted slot of the probes of the hash
+    static size_t free_position( const table* tab, uint64_t hash )
+    {
+        size_t g = first_group( tab, hash );
+        for( size_t step = 1; ; ++step )
+        {
+            uint32_t bitmask = mask_to_bitmask< int8_t, Tag_T >( load< int8_t, Tag_T >( tab->groups[ g ].ctrl ) );
+            if( bitmask != 0 )
+                return g * group_size + bitmask_first_index< int8_t, Tag_T >( bitmask );
+
+            g = (g + step) & tab->group_mask;
+        }
+    }
+
+    constexpr static size_t npos = ~static_cast< size_t >( 0 );
+
+    // The writer changes the group between two increments of its sequence
+    static void lock_group( group_type& group )
+    {
+        group.seq.store( group.seq.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+    }
+
+    static void unlock_group( group_type& group )
+    {
+        group.seq.store( group.seq.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+    }
+
+    // Stores the value on the slot, the new key when ctrl is given
+    static void store( table* tab, size_t pos, const Key_T& key, const Mapped_T& value, int8_t ctrl )
+    {
+        group_type& group = tab->groups[ pos / group_size ];
+        size_t index = pos % group_size;
+        lock_group( group );
+        if( group.ctrl[ index ] < 0 )
+        {
+            tab->growth_left -= (group.ctrl[ index ] == detail::hash_ctrl_empty) ? 1 : 0;
+            group.keys[ index ] = key;
+            group.ctrl[ index ] = ctrl;
+        }
+        group.values[ index ] = value;
+        unlock_group( group );
+    }
+
+    static bool erase_position( table* tab, const Key_T& key, uint64_t hash )
+    {
+        size_t pos = position( tab, key, hash );
+        if( pos == npos )
+            return false;
+
+        // No probe passed a group with an empty slot
+        group_type& group = tab->groups[ pos / group_size ];
+        ctrl_simd empty( detail::hash_ctrl_empty );
+        bool has_empty = equal_to_bitmask< int8_t, Tag_T >( load< int8_t, Tag_T >( group.ctrl ), empty ) != 0;
+        lock_group( group );
+        group.ctrl[ pos % group_size ] = has_empty ? detail::hash_ctrl_empty : detail::hash_ctrl_deleted;
+        unlock_group( group );
+        tab->growth_left += has_empty ? 1 : 0;
+        return true;
+    }
+
+    bool write( const Key_T& key, const Mapped_T& value, bool assign )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        uint64_t hash = detail::hash_mix( Hash_T()( key ) );
+        migrate();
+
+        table* current = table_.load( std::memory_order_relaxed );
+        size_t pos = position( current, key, hash );
+        if( pos != npos )
+        {
+            if( assign )
+                store( current, pos, key, value, 0 );
+            return false;
+        }
+
+        // The new values go to the new table, where the readers search first
+        table* old = old_.load( std::memory_order_relaxed );
+        bool exists = old != nullptr && position( old, key, hash ) != npos;
+        if( exists && !assign )
+            return false;
+
+        pos = free_position( current, hash );
+        if( current->growth_left == 0 && current->groups[ pos / group_size ].ctrl[ pos % group_size ] == detail::hash_ctrl_empty )
+        {
+            // The growth may move the old value of the key to the new table
+            grow();
+            current = table_.load( std::memory_order_relaxed );
+            pos = position( current, key, hash );
+            pos = (pos != npos) ? pos : free_position( current, hash );
+        }
+        store( current, pos, key, value, static_cast< int8_t >( hash & 0x7f ) );
+
+        if( exists )
+            return false;
+
+        size_.store( size_.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        return true;
+    }
+
+    // Starts moving the values to a new table. Doubles the size when the values use
+    // more than half of the load, otherwise only the deleted slots are dropped.
+    void grow()
+    {
+        // The previous growth must end before the next one
+        while( old_.load( std::memory_order_relaxed ) != nullptr )
+            migrate();
+
+        table* current = table_.load( std::memory_order_relaxed );
+        size_t groups = current->group_mask + 1;
+        table* next = new table( size() + 1 > max_load( current->capacity() ) / 2 ? groups * 2 : groups );
+
+        // The readers which see the new table also see the old one
+        old_.store( current, std::memory_order_release );
+        table_.store( next, std::memory_order_release );
+        migrated_ = 0;
+        migrate();
+    }
+
+    // Moves the next groups of the old table. The values stay on the old table, as the
+    // readers may be searching it, and only the erases change it. The values already on
+    // the new table are newer.
+    void migrate()
+    {
+        table* old = old_.load( std::memory_order_relaxed );
+        if( old == nullptr )
+            return;
+
+        table* current = table_.load( std::memory_order_relaxed );
+        size_t last = std::min( migrated_ + migrate_groups, old->group_mask + 1 );
+        for( ; migrated_ < last; ++migrated_ )
+        {
+            const group_type& group = old->groups[ migrated_ ];
+            for( size_t i = 0; i < group_size; ++i )
+            {
+                if( group.ctrl[ i ] < 0 )
+                    continue;
+
+                uint64_t hash = detail::hash_mix( Hash_T()( group.keys[ i ] ) );
+                if( position( current, group.keys[ i ], hash ) == npos )
+                    store( current, free_position( current, hash ), group.keys[ i ], group.values[ i ],
+                           static_cast< int8_t >( hash & 0x7f ) );
+            }
+        }
+
+        if( migrated_ > old->group_mask )
+        {
+            old_.store( nullptr, std::memory_order_release );
+            retired_.push_back( old );
+        }
+    }
+};
+
+template< typename Key_T, typename Mapped_T, typename Hash_T, typename KeyEqual_T, typename Tag_T >
+constexpr size_t concurrent_hash_map< Key_T, Mapped_T, Hash_T, KeyEqual_T, Tag_T >::group_size;
+
+template< typename Key_T, typename Mapped_T, typename Hash_T, typename KeyEqual_T, typename Tag_T >
+constexpr size_t concurrent_hash_map< Key_T, Mapped_T, Hash_T, KeyEqual_T, Tag_T >::migrate_groups;
+
+template< typename Key_T, typename Mapped_T, typename Hash_T, typename KeyEqual_T, typename Tag_T >
+constexpr size_t concurrent_hash_map< Key_T, Mapped_T, Hash_T, KeyEqual_T, Tag_T >::npos;
+
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_CONCURRENT_HASH_MAP_H
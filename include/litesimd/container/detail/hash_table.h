@@ -0,0 +1,610 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_DETAIL_HASH_TABLE_H
+#define LITESIMD_CONTAINER_DETAIL_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/algorithm/for_each.h>
+#include <litesimd/helpers/containers.h>
+
+namespace litesimd {
+namespace detail {
+
+// Control bytes of the slots. The full slots keep the 7 low bits of the hash, so the
+// negative values are the empty and the deleted slots.
+constexpr int8_t hash_ctrl_empty = -128;
+constexpr int8_t hash_ctrl_deleted = -2;
+
+// Keys searched at the same time by find_many
+constexpr size_t hash_batch_group = 16;
+
+// Spreads the bits of the hash, the identity hash of the integers would put the
+// sequential keys on the same group and with the same control byte
+inline uint64_t hash_mix( size_t hash )
+{
+    uint64_t mixed = static_cast< uint64_t >( hash ) * UINT64_C( 0x9e3779b97f4a7c15 );
+    return mixed ^ (mixed >> 32);
+}
+
+// Key of the values of the sets and of the maps
+struct hash_key_identity
+{
+    template< typename Value_T >
+    const Value_T& operator()( const Value_T& value ) const { return value; }
+};
+
+struct hash_key_first
+{
+    template< typename Value_T >
+    const typename Value_T::first_type& operator()( const Value_T& value ) const { return value.first; }
+};
+
+// Open addressing hash table with the slots split on groups of one SIMD register of
+// control bytes. A search compares the 7 bits tag of the key with all control bytes of
+// the group at once and only the matching slots compare the keys. The groups are probed
+// on triangular steps, which visit all groups of the power of 2 table.
+//
+// A group with an empty slot ends the probes, so the erase leaves a deleted slot when
+// the group is full, as a search could have passed this group before the erase.
+template< typename Value_T, typename Key_T, typename KeyOf_T, typename Hash_T,
+          typename KeyEqual_T, typename Tag_T, bool Mutable_T >
+class hash_table
+{
+    using ctrl_simd = simd_type< int8_t, Tag_T >;
+    using slot_type = typename std::aligned_storage< sizeof( Value_T ), alignof( Value_T ) >::type;
+
+public:
+    /// Slots on each group, one control byte per SIMD register lane
+    constexpr static size_t group_size = ctrl_simd::simd_size;
+
+    using key_type        = Key_T;
+    using value_type      = Value_T;
+    using size_type       = size_t;
+    using difference_type = ptrdiff_t;
+    using hasher          = Hash_T;
+    using key_equal       = KeyEqual_T;
+
+    /// Forward iterator over the full slots
+    template< typename Reference_T >
+    class basic_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Value_T;
+        using difference_type   = ptrdiff_t;
+        using pointer           = Reference_T*;
+        using reference         = Reference_T&;
+
+        basic_iterator() : ctrl_( nullptr ), slot_( nullptr ) {}
+
+        // The mutable iterators convert to the constant ones
+        template< typename Other_T, typename std::enable_if<
+                      !std::is_same< Other_T, Reference_T >::value &&
+                      std::is_same< const Other_T, Reference_T >::value >::type* = nullptr >
+        basic_iterator( const basic_iterator< Other_T >& other )
+            : ctrl_( other.ctrl_ ), slot_( other.slot_ ) {}
+
+        reference operator*() const { return *slot_; }
+        pointer operator->() const { return slot_; }
+
+        basic_iterator& operator++()
+        {
+            ++ctrl_;
+            ++slot_;
+            skip();
+            return *this;
+        }
+
+        basic_iterator operator++( int )
+        {
+            basic_iterator ret( *this );
+            ++(*this);
+            return ret;
+        }
+
+        bool operator==( const basic_iterator& rhs ) const { return ctrl_ == rhs.ctrl_; }
+        bool operator!=( const basic_iterator& rhs ) const { return ctrl_ != rhs.ctrl_; }
+
+    private:
+        friend class hash_table;
+        template< typename > friend class basic_iterator;
+
+        basic_iterator( const int8_t* ctrl, Reference_T* slot ) : ctrl_( ctrl ), slot_( slot ) {}
+
+        // The control bytes end with a full sentinel
+        void skip()
+        {
+            while( *ctrl_ < 0 )
+            {
+                ++ctrl_;
+                ++slot_;
+            }
+        }
+
+        const int8_t* ctrl_;
+        Reference_T* slot_;
+    };
+
+    using iterator       = basic_iterator< typename std::conditional< Mutable_T, Value_T, const Value_T >::type >;
+    using const_iterator = basic_iterator< const Value_T >;
+
+    /// Empty table, without memory allocated
+    hash_table() : size_( 0 ), growth_left_( 0 ), group_mask_( 0 ) {}
+
+    /**
+     * \brief Builds the table from a range of values
+     *
+     * \param first, last Range of values, the repeated keys keep the first value
+     */
+    template< typename Iterator_T >
+    hash_table( Iterator_T first, Iterator_T last )
+        : hash_table()
+    {
+        insert( first, last );
+    }
+
+    hash_table( const hash_table& other )
+        : hash_table()
+    {
+        reserve( other.size() );
+        for( const Value_T& value : other )
+            emplace_new( hash_of( KeyOf_T()( value ) ), value );
+    }
+
+    hash_table( hash_table&& other )
+        : hash_table()
+    {
+        swap( other );
+    }
+
+    hash_table& operator=( hash_table other )
+    {
+        swap( other );
+        return *this;
+    }
+
+    ~hash_table()
+    {
+        destroy();
+    }
+
+    void swap( hash_table& other )
+    {
+        ctrl_.swap( other.ctrl_ );
+        slots_.swap( other.slots_ );
+        std::swap( size_, other.size_ );
+        std::swap( growth_left_, other.growth_left_ );
+        std::swap( group_mask_, other.group_mask_ );
+    }
+
+    /// Iterator to the first value
+    iterator begin()
+    {
+        iterator it( ctrl(), slot( 0 ) );
+        it.skip();
+        return it;
+    }
+
+    /// Iterator past the last value
+    iterator end() { return iterator( ctrl() + capacity(), slot( capacity() ) ); }
+
+    /// Iterator to the first value
+    const_iterator begin() const { return const_cast< hash_table* >( this )->begin(); }
+
+    /// Iterator past the last value
+    const_iterator end() const { return const_cast< hash_table* >( this )->end(); }
+
+    /// Number of values
+    size_t size() const { return size_; }
+
+    /// True when the table has no values
+    bool empty() const { return size_ == 0; }
+
+    /// Number of slots
+    size_t capacity() const { return slots_.size(); }
+
+    /// Removes all values, keeping the memory
+    void clear()
+    {
+        destroy_values();
+        std::fill( ctrl_.begin(), ctrl_.begin() + capacity(), hash_ctrl_empty );
+        size_ = 0;
+        growth_left_ = max_load( capacity() );
+    }
+
+    /**
+     * \brief Grows the table to hold count values without rehashing
+     *
+     * \param count Number of values
+     */
+    void reserve( size_t count )
+    {
+        size_t groups = groups_for( count );
+        if( groups * group_size > capacity() )
+            rehash( groups );
+    }
+
+    /**
+     * \brief Inserts a value, when the table has no value with the same key
+     *
+     * \param value Value to insert
+     * \returns Pair with the iterator to the value with the key and true when the
+     * value was inserted
+     */
+    std::pair< iterator, bool > insert( const Value_T& value )
+    {
+        return emplace_key( KeyOf_T()( value ), value );
+    }
+
+    std::pair< iterator, bool > insert( Value_T&& value )
+    {
+        return emplace_key( KeyOf_T()( value ), std::move( value ) );
+    }
+
+    /**
+     * \brief Inserts a range of values
+     *
+     * \param first, last Range of values
+     */
+    template< typename Iterator_T >
+    void insert( Iterator_T first, Iterator_T last )
+    {
+        for( ; first != last; ++first )
+            insert( *first );
+    }
+
+    /**
+     * \brief Removes the value with the key
+     *
+     * \param key Key to remove
+     * \returns Number of values removed, 0 or 1
+     */
+    size_t erase( const Key_T& key )
+    {
+        size_t pos;
+        if( !find_position( key, hash_of( key ), pos ) )
+            return 0;
+
+        erase_position( pos );
+        return 1;
+    }
+
+    /**
+     * \brief Removes the value on the iterator
+     *
+     * \param pos Iterator to the value to remove
+     * \returns Iterator to the next value
+     */
+    iterator erase( const_iterator pos )
+    {
+        size_t index = static_cast< size_t >( pos.ctrl_ - ctrl() );
+        erase_position( index );
+        iterator it( ctrl() + index, slot( index ) );
+        it.skip();
+        return it;
+    }
+
+    /**
+     * \brief Finds the value with the key
+     *
+     * \param key Key to search
+     * \returns Iterator to the value, or end() when not found
+     */
+    iterator find( const Key_T& key )
+    {
+        size_t pos;
+        return find_position( key, hash_of( key ), pos ) ? iterator( ctrl() + pos, slot( pos ) ) : end();
+    }
+
+    const_iterator find( const Key_T& key ) const
+    {
+        return const_cast< hash_table* >( this )->find( key );
+    }
+
+    /**
+     * \brief Checks if the table has a value with the key
+     *
+     * \param key Key to search
+     * \returns True when the key was found
+     */
+    bool contains( const Key_T& key ) const
+    {
+        size_t pos;
+        return find_position( key, hash_of( key ), pos );
+    }
+
+    /**
+     * \brief Number of values with the key
+     *
+     * \param key Key to search
+     * \returns 1 when the key was found, 0 otherwise
+     */
+    size_t count( const Key_T& key ) const
+    {
+        return contains( key ) ? 1 : 0;
+    }
+
+    /**
+     * \brief Finds a range of keys, writing the iterator of each one, or end()
+     *
+     * The keys are hashed on batches of 16. The control bytes of all keys of the batch are
+     * prefetched, then the slots matching their tags, before the first search, so the
+     * cache misses of the keys overlap instead of paying the memory latency one by one.
+     *
+     * \param first, last Range of keys to search
+     * \param out Output iterator of const_iterator
+     * \returns Output iterator past the last iterator written
+     */
+    template< typename Iterator_T, typename Output_T >
+    Output_T find_many( Iterator_T first, Iterator_T last, Output_T out ) const
+    {
+        uint64_t hashes[ hash_batch_group ];
+        while( first != last )
+        {
+            Iterator_T group = first;
+            size_t count = 0;
+            for( ; count < hash_batch_group && first != last; ++count, ++first )
+            {
+                hashes[ count ] = hash_of( *first );
+                prefetch< Tag_T >( ctrl() + group_position( hashes[ count ] ) );
+            }
+
+            // The control bytes arrived while the other keys were hashed, the first
+            // slot matching the tag is the most likely place of the key
+            if( !ctrl_.empty() )
+            {
+                for( size_t i = 0; i < count; ++i )
+                {
+                    size_t pos = group_position( hashes[ i ] );
+                    uint32_t bitmask = equal_to_bitmask< int8_t, Tag_T >(
+                        load< int8_t, Tag_T >( ctrl_.data() + pos ), ctrl_simd( static_cast< int8_t >( hashes[ i ] & 0x7f ) ) );
+                    if( bitmask != 0 )
+                        prefetch< Tag_T >( slot( pos + bitmask_first_index< int8_t, Tag_T >( bitmask ) ) );
+                }
+            }
+
+            for( size_t i = 0; i < count; ++i, ++group )
+            {
+                size_t pos;
+                *out++ = find_position( *group, hashes[ i ], pos ) ? const_iterator( ctrl() + pos, slot( pos ) ) : end();
+            }
+        }
+        return out;
+    }
+
+    /// Hash function object
+    hasher hash_function() const { return hasher(); }
+
+    /// Key comparison function object
+    key_equal key_eq() const { return key_equal(); }
+
+protected:
+    // Inserts a value built from args when the key is not on the table
+    template< typename... Args_T >
+    std::pair< iterator, bool > emplace_key( const Key_T& key, Args_T&&... args )
+    {
+        uint64_t hash = hash_of( key );
+        size_t pos;
+        if( find_position( key, hash, pos ) )
+            return std::make_pair( iterator( ctrl() + pos, slot( pos ) ), false );
+
+        pos = emplace_new( hash, std::forward< Args_T >( args )... );
+        return std::make_pair( iterator( ctrl() + pos, slot( pos ) ), true );
+    }
+
+private:
+    vector< int8_t > ctrl_;
+    std::vector< slot_type > slots_;
+    size_t size_;
+    size_t growth_left_;   // Values inserted on empty slots before the rehash
+    size_t group_mask_;
+
+    static uint64_t hash_of( const Key_T& key )
+    {
+        return hash_mix( Hash_T()( key ) );
+    }
+
+    // First slot of the first group probed by the hash
+    size_t group_position( uint64_t hash ) const
+    {
+        return (static_cast< size_t >( hash >> 7 ) & group_mask_) * group_size;
+    }
+
+    // 7/8 of the slots may be used, counting the deleted ones
+    static size_t max_load( size_t capacity )
+    {
+        return capacity - capacity / 8;
+    }
+
+    // Power of 2 number of groups to hold count values
+    static size_t groups_for( size_t count )
+    {
+        size_t groups = 1;
+        while( max_load( groups * group_size ) < count )
+            groups *= 2;
+        return groups;
+    }
+
+    const int8_t* ctrl() const
+    {
+        // The sentinel of the table without memory
+        static const int8_t sentinel = 0;
+        return ctrl_.empty() ? &sentinel : ctrl_.data();
+    }
+
+    Value_T* slot( size_t pos ) const
+    {
+        return reinterpret_cast< Value_T* >( const_cast< slot_type* >( slots_.data() ) ) + pos;
+    }
+
+    bool find_position( const Key_T& key, uint64_t hash, size_t& pos ) const
+    {
+        if( ctrl_.empty() )
+            return false;
+
+        const int8_t* ctrl = ctrl_.data();
+        ctrl_simd tag( static_cast< int8_t >( hash & 0x7f ) );
+        ctrl_simd empty( hash_ctrl_empty );
+        size_t group = group_position( hash ) / group_size;
+        for( size_t step = 1; ; ++step )
+        {
+            ctrl_simd ctrl_vec = load< int8_t, Tag_T >( ctrl + group * group_size );
+            bool found = false;
+            auto compare = [&]( int index ) -> bool
+            {
+                pos = group * group_size + index;
+                found = KeyEqual_T()( KeyOf_T()( *slot( pos ) ), key );
+                return !found;
+            };
+            for_each_index< int8_t, decltype( compare ), Tag_T >(
+                equal_to_bitmask< int8_t, Tag_T >( ctrl_vec, tag ), compare );
+            if( found )
+                return true;
+
+            if( equal_to_bitmask< int8_t, Tag_T >( ctrl_vec, empty ) != 0 )
+                return false;
+
+            // All groups were probed only when the table has no empty slot, which the
+            // load factor prevents
+            group = (group + step) & group_mask_;
+        }
+    }
+
+    // First empty or deleted slot of the probes of the hash
+    size_t free_position( uint64_t hash ) const
+    {
+        const int8_t* ctrl = ctrl_.data();
+        size_t group = group_position( hash ) / group_size;
+        for( size_t step = 1; ; ++step )
+        {
+            // The empty and the deleted control bytes have the sign bit set
+            uint32_t bitmask = mask_to_bitmask< int8_t, Tag_T >( load< int8_t, Tag_T >( ctrl + group * group_size ) );
+            if( bitmask != 0 )
+                return group * group_size + bitmask_first_index< int8_t, Tag_T >( bitmask );
+
+            group = (group + step) & group_mask_;
+        }
+    }
+
+    // Inserts a value of a key not on the table
+    template< typename... Args_T >
+    size_t emplace_new( uint64_t hash, Args_T&&... args )
+    {
+        size_t pos = free_position_growing( hash );
+        ::new( static_cast< void* >( slot( pos ) ) ) Value_T( std::forward< Args_T >( args )... );
+        return pos;
+    }
+
+    size_t free_position_growing( uint64_t hash )
+    {
+        size_t pos = ctrl_.empty() ? 0 : free_position( hash );
+        if( ctrl_.empty() || (growth_left_ == 0 && ctrl_[ pos ] == hash_ctrl_empty) )
+        {
+            // Grows when the values use more than half of the load, otherwise only
+            // the deleted slots are cleaned
+            size_t groups = group_mask_ + 1;
+            rehash( ctrl_.empty() ? 1 : (size_ + 1 > max_load( capacity() ) / 2 ? groups * 2 : groups) );
+            pos = free_position( hash );
+        }
+
+        growth_left_ -= (ctrl_[ pos ] == hash_ctrl_empty) ? 1 : 0;
+        ctrl_[ pos ] = static_cast< int8_t >( hash & 0x7f );
+        ++size_;
+        return pos;
+    }
+
+    void erase_position( size_t pos )
+    {
+        slot( pos )->~Value_T();
+        --size_;
+
+        // No probe passed a group with an empty slot
+        size_t group = pos / group_size * group_size;
+        ctrl_simd empty( hash_ctrl_empty );
+        if( equal_to_bitmask< int8_t, Tag_T >( load< int8_t, Tag_T >( ctrl_.data() + group ), empty ) != 0 )
+        {
+            ctrl_[ pos ] = hash_ctrl_empty;
+            ++growth_left_;
+        }
+        else
+        {
+            ctrl_[ pos ] = hash_ctrl_deleted;
+        }
+    }
+
+    void rehash( size_t groups )
+    {
+        hash_table table;
+        table.ctrl_.assign( groups * group_size + 1, hash_ctrl_empty );
+        table.ctrl_.back() = 0;
+        table.slots_.resize( groups * group_size );
+        table.group_mask_ = groups - 1;
+        table.growth_left_ = max_load( groups * group_size );
+
+        for( size_t i = 0; i < capacity(); ++i )
+        {
+            if( ctrl_[ i ] >= 0 )
+            {
+                table.emplace_new( hash_of( KeyOf_T()( *slot( i ) ) ), std::move( *slot( i ) ) );
+                slot( i )->~Value_T();
+            }
+        }
+        std::fill( ctrl_.begin(), ctrl_.end(), hash_ctrl_empty );
+        size_ = 0;
+        swap( table );
+    }
+
+    void destroy_values()
+    {
+        for( size_t i = 0; i < capacity(); ++i )
+            if( ctrl_[ i ] >= 0 )
+                slot( i )->~Value_T();
+    }
+
+    void destroy()
+    {
+        destroy_values();
+        ctrl_.clear();
+        slots_.clear();
+        size_ = growth_left_ = group_mask_ = 0;
+    }
+};
+
+template< typename Value_T, typename Key_T, typename KeyOf_T, typename Hash_T,
+          typename KeyEqual_T, typename Tag_T, bool Mutable_T >
+constexpr size_t hash_table< Value_T, Key_T, KeyOf_T, Hash_T, KeyEqual_T, Tag_T, Mutable_T >::group_size;
+
+} // namespace detail
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_DETAIL_HASH_TABLE_H
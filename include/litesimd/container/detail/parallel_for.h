@@ -0,0 +1,60 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_DETAIL_PARALLEL_FOR_H
+#define LITESIMD_CONTAINER_DETAIL_PARALLEL_FOR_H
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+namespace litesimd {
+namespace detail {
+
+// Threads used when the caller asks for 0, one for each core
+inline size_t parallel_threads( size_t threads )
+{
+    return (threads != 0) ? threads : std::max< size_t >( 1, std::thread::hardware_concurrency() );
+}
+
+// Splits [0, count) on equal parts and calls func( begin, end ) for each part on its own
+// thread, the first part on the calling thread. Returns after all parts are done.
+template< typename Function_T >
+inline void parallel_for( size_t count, size_t threads, Function_T func )
+{
+    threads = std::max< size_t >( 1, std::min( threads, count ) );
+
+    std::vector< std::thread > workers;
+    workers.reserve( threads - 1 );
+    for( size_t t = 1; t < threads; ++t )
+        workers.emplace_back( func, count * t / threads, count * (t + 1) / threads );
+
+    func( 0, count / threads );
+    for( auto& worker : workers )
+        worker.join();
+}
+
+} // namespace detail
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_DETAIL_PARALLEL_FOR_H
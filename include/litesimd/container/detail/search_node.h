@@ -0,0 +1,109 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_DETAIL_SEARCH_NODE_H
+#define LITESIMD_CONTAINER_DETAIL_SEARCH_NODE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/algorithm/binary_search.h>
+
+namespace litesimd {
+namespace detail {
+
+// Key used to fill the unused slots of the nodes, greater or equal than all keys
+template< typename Key_T >
+inline Key_T search_node_pad()
+{
+    return std::numeric_limits< Key_T >::has_infinity ? std::numeric_limits< Key_T >::infinity()
+                                                      : std::numeric_limits< Key_T >::max();
+}
+
+// Number of keys of the node before the bound of the key. Lower counts the keys less
+// than the key and upper counts the keys less or equal to the key. The node keys must
+// be already mapped by search_traits.
+template< typename Tag_T, size_t NodeSize_T, bool Upper_T, typename SearchType_T >
+inline size_t search_node_count( const SearchType_T* node, simd_type< SearchType_T, Tag_T > key )
+{
+    return Upper_T ? NodeSize_T - bit_count< Tag_T >( greater_node_bitmask< NodeSize_T >( node, key ) )
+                   : bit_count< Tag_T >( greater_node_bitmask< NodeSize_T >( key, node ) );
+}
+
+// Same count on nodes of original keys, the unsigned ones are mapped while loaded
+template< typename Tag_T, size_t NodeSize_T, bool Upper_T, typename Key_T >
+inline size_t search_key_count( const Key_T* node,
+                                simd_type< typename search_traits< Key_T >::type, Tag_T > key,
+                                std::false_type )
+{
+    using search_type = typename search_traits< Key_T >::type;
+    return search_node_count< Tag_T, NodeSize_T, Upper_T >(
+                reinterpret_cast< const search_type* >( node ), key );
+}
+
+template< typename Tag_T, size_t NodeSize_T, bool Upper_T, typename Key_T >
+inline size_t search_key_count( const Key_T* node,
+                                simd_type< typename search_traits< Key_T >::type, Tag_T > key,
+                                std::true_type )
+{
+    using search_type = typename search_traits< Key_T >::type;
+    using simd = simd_type< search_type, Tag_T >;
+
+    const search_type* keys = reinterpret_cast< const search_type* >( node );
+    uint64_t bitmask = 0;
+    for( size_t i = 0; i < NodeSize_T; i += simd::simd_size )
+    {
+        simd vec = search_map< Tag_T, Key_T >( load< search_type, Tag_T >( keys + i ) );
+        bitmask |= static_cast< uint64_t >( mask_to_lane_bitmask< search_type, Tag_T >( Upper_T
+                        ? greater< search_type, Tag_T >( vec, key )
+                        : greater< search_type, Tag_T >( key, vec ) ) ) << i;
+    }
+    return Upper_T ? NodeSize_T - bit_count< Tag_T >( bitmask ) : bit_count< Tag_T >( bitmask );
+}
+
+// Lane bitmask of the keys of the register less than the key
+template< typename Tag_T, typename Key_T >
+inline uint32_t search_less_lanes( const Key_T* keys,
+                                   simd_type< typename search_traits< Key_T >::type, Tag_T > key )
+{
+    using search_type = typename search_traits< Key_T >::type;
+    return mask_to_lane_bitmask< search_type, Tag_T >( greater< search_type, Tag_T >( key,
+                search_map< Tag_T, Key_T >( load< search_type, Tag_T >(
+                    reinterpret_cast< const search_type* >( keys ) ) ) ) );
+}
+
+// Start of the SIMD register of the key, the nodes are aligned to the registers
+template< typename Tag_T, typename Key_T >
+inline const Key_T* search_register( const Key_T* key )
+{
+    constexpr uintptr_t bytes = sizeof( simd_type< typename search_traits< Key_T >::type, Tag_T > );
+    return reinterpret_cast< const Key_T* >( reinterpret_cast< uintptr_t >( key ) & ~(bytes - 1) );
+}
+
+} // namespace detail
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_DETAIL_SEARCH_NODE_H
@@ -0,0 +1,291 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_EYTZINGER_ARRAY_H
+#define LITESIMD_CONTAINER_EYTZINGER_ARRAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/algorithm/binary_search.h>
+#include <litesimd/helpers/containers.h>
+#include <litesimd/container/detail/search_node.h>
+
+namespace litesimd {
+
+/**
+ * \ingroup container
+ * \brief Read only set of keys on the Eytzinger (breadth first) layout of an implicit
+ * search tree, searched by a branchless descent.
+ *
+ * With one key per node, the default, the children of the slot k are on the slots 2k
+ * and 2k + 1, and the descent is a conditional move per level. The 16 slots of the
+ * descendants four levels below (8 slots, three levels, on 64 bits keys) are on a
+ * single cache line, which is prefetched on each step, so the cache misses of the levels
+ * overlap while the descent goes on.
+ *
+ * With NodeSize_T keys per node, a multiple of the SIMD register size up to a cache
+ * line, the layout is a k-ary Eytzinger of NodeSize_T + 1 children and each level counts
+ * the keys less than the key with greater_node_bitmask and bit_count. This is the same
+ * search of the static_search_tree, without its copy of the keys on the leaves.
+ *
+ * The keys are stored on the layout order, so the begin() and end() iterators visit the
+ * slots on breadth first order. The k-ary layout fills the slots of the last node with
+ * up to NodeSize_T - 1 padding keys, which are also visited. The searches return
+ * iterators to the keys found, or end().
+ *
+ * \tparam Key_T Key type
+ * \tparam Tag_T Instruction set used on the searches
+ * \tparam NodeSize_T Keys per node, 1 or a multiple of the SIMD register size
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/container.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values;
+ *     for( int32_t i = 0; i < 100; ++i )
+ *         values.push_back( i * 2 );
+ *
+ *     ls::eytzinger_array< int32_t > binary( values.begin(), values.end() );
+ *     ls::eytzinger_array< int32_t, ls::sse_tag, 4 > kary( values.begin(), values.end() );
+ *
+ *     std::cout << "binary.lower_bound( 51 ): " << *binary.lower_bound( 51 ) << std::endl
+ *               << "kary.upper_bound( 52 ): " << *kary.upper_bound( 52 ) << std::endl
+ *               << "kary.contains( 53 ): " << kary.contains( 53 ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * binary.lower_bound( 51 ): 52
+ * kary.upper_bound( 52 ): 54
+ * kary.contains( 53 ): 0
+ * ```
+ */
+template< typename Key_T, typename Tag_T = default_tag, size_t NodeSize_T = 1 >
+class eytzinger_array
+{
+    static_assert( detail::is_searchable< Key_T >::value,
+                   "eytzinger_array supports only integer, float and double keys" );
+
+    using traits = detail::search_traits< Key_T >;
+    using search_type = typename traits::type;
+    using simd = simd_type< search_type, Tag_T >;
+
+    static_assert( NodeSize_T == 1 || (NodeSize_T % simd::simd_size == 0 && NodeSize_T <= 64),
+                   "eytzinger_array node size must be 1 or a multiple of the SIMD register size" );
+
+    // Keys on a cache line, the slots prefetched on each step of the binary descent
+    constexpr static size_t line_size = 64 / sizeof( Key_T ) ? 64 / sizeof( Key_T ) : 1;
+
+    // The binary layout starts on the slot 1, so the descendants of each slot are on a
+    // cache line. The k-ary layout starts on the slot 0.
+    constexpr static size_t first_slot = (NodeSize_T == 1) ? 1 : 0;
+
+public:
+    using key_type        = Key_T;
+    using value_type      = Key_T;
+    using size_type       = size_t;
+    using const_reference = const Key_T&;
+    using const_iterator  = const Key_T*;
+    using iterator        = const_iterator;
+
+    /// Keys per node
+    constexpr static size_t node_size = NodeSize_T;
+
+    /// Empty array
+    eytzinger_array() : size_( 0 ), nodes_( 0 ), last_( 0 ) {}
+
+    /**
+     * \brief Builds the layout from a sorted range
+     *
+     * \param first, last Sorted range of keys
+     */
+    template< typename Iterator_T >
+    eytzinger_array( Iterator_T first, Iterator_T last )
+        : size_( static_cast< size_t >( std::distance( first, last ) ) ),
+          nodes_( (size_ + NodeSize_T - 1) / NodeSize_T ), last_( 0 )
+    {
+        // The last node is filled with the padding key, greater or equal than all keys
+        keys_.resize( first_slot + nodes_ * NodeSize_T, detail::search_node_pad< Key_T >() );
+        size_t rank = 0;
+        fill( first, rank, first_slot, std::integral_constant< bool, NodeSize_T == 1 >() );
+    }
+
+    /// Iterator to the first slot of the layout
+    const_iterator begin() const { return keys_.data() + first_slot; }
+
+    /// Iterator past the last slot of the layout, returned when the searches fail
+    const_iterator end() const { return keys_.data() + keys_.size(); }
+
+    /// Number of keys
+    size_t size() const { return size_; }
+
+    /// Number of slots of the layout, the keys and the padding
+    size_t slots() const { return nodes_ * NodeSize_T; }
+
+    /// True when the array has no keys
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * \brief Returns the smallest key not less than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the smallest key not less than key, or end()
+     */
+    const_iterator lower_bound( const Key_T& key ) const
+    {
+        return bound< false >( key );
+    }
+
+    /**
+     * \brief Returns the smallest key greater than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the smallest key greater than key, or end()
+     */
+    const_iterator upper_bound( const Key_T& key ) const
+    {
+        return bound< true >( key );
+    }
+
+    /**
+     * \brief Finds a key equal to key
+     *
+     * \param key Key to search
+     * \returns Iterator to a key equal to key, or end() when not found
+     */
+    const_iterator find( const Key_T& key ) const
+    {
+        const_iterator it = lower_bound( key );
+        return (it != end() && !(key < *it)) ? it : end();
+    }
+
+    /**
+     * \brief Checks if the array has a key equal to key
+     *
+     * \param key Key to search
+     * \returns True when the key was found
+     */
+    bool contains( const Key_T& key ) const
+    {
+        return find( key ) != end();
+    }
+
+private:
+    size_t size_;
+    size_t nodes_;
+    size_t last_;   // Slot of the greatest key, the slots after it on the search order are padding
+    vector< Key_T > keys_;
+
+    // In order traversal of the binary layout
+    template< typename Iterator_T >
+    void fill( Iterator_T& it, size_t& rank, size_t slot, std::true_type )
+    {
+        if( slot > size_ )
+            return;
+
+        fill( it, rank, 2 * slot, std::true_type() );
+        keys_[ slot ] = *it++;
+        if( ++rank == size_ )
+            last_ = slot;
+        fill( it, rank, 2 * slot + 1, std::true_type() );
+    }
+
+    // In order traversal of the k-ary layout, the padding keys are the last ones
+    template< typename Iterator_T >
+    void fill( Iterator_T& it, size_t& rank, size_t node, std::false_type )
+    {
+        if( node >= nodes_ )
+            return;
+
+        for( size_t i = 0; i <= NodeSize_T; ++i )
+        {
+            fill( it, rank, node * (NodeSize_T + 1) + i + 1, std::false_type() );
+            if( i < NodeSize_T && rank < size_ )
+            {
+                keys_[ node * NodeSize_T + i ] = *it++;
+                if( ++rank == size_ )
+                    last_ = node * NodeSize_T + i;
+            }
+        }
+    }
+
+    template< bool Upper_T >
+    const_iterator bound( const Key_T& key ) const
+    {
+        // Past the greatest key the descent would stop on the padding
+        if( empty() || (Upper_T ? !(key < keys_[ last_ ]) : keys_[ last_ ] < key) )
+            return end();
+
+        return keys_.data() + descent< Upper_T >( key, std::integral_constant< bool, NodeSize_T == 1 >() );
+    }
+
+    template< bool Upper_T >
+    size_t descent( const Key_T& key, std::true_type ) const
+    {
+        const Key_T* keys = keys_.data();
+        size_t slot = 1;
+        size_t found = last_;
+        while( slot <= size_ )
+        {
+            prefetch< Tag_T >( keys + slot * line_size );
+            bool right = Upper_T ? !(key < keys[ slot ]) : keys[ slot ] < key;
+            found = right ? found : slot;
+            slot = 2 * slot + right;
+        }
+        return found;
+    }
+
+    template< bool Upper_T >
+    size_t descent( const Key_T& key, std::false_type ) const
+    {
+        simd skey( traits::to( key ) );
+        size_t node = 0;
+        size_t found = last_;
+        while( node < nodes_ )
+        {
+            size_t count = detail::search_key_count< Tag_T, NodeSize_T, Upper_T >(
+                                keys_.data() + node * NodeSize_T, skey, std::is_unsigned< Key_T >() );
+            found = (count < NodeSize_T) ? node * NodeSize_T + count : found;
+            node = node * (NodeSize_T + 1) + count + 1;
+        }
+        return found;
+    }
+};
+
+template< typename Key_T, typename Tag_T, size_t NodeSize_T >
+constexpr size_t eytzinger_array< Key_T, Tag_T, NodeSize_T >::node_size;
+
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_EYTZINGER_ARRAY_H
@@ -0,0 +1,142 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_FLAT_HASH_MAP_H
+#define LITESIMD_CONTAINER_FLAT_HASH_MAP_H
+
+#include <tuple>
+#include <utility>
+#include <functional>
+#include <litesimd/types.h>
+#include <litesimd/container/detail/hash_table.h>
+
+namespace litesimd {
+
+/**
+ * \ingroup container
+ * \brief Unordered map on an open addressing hash table, with the slots searched by
+ * groups of SIMD control bytes.
+ *
+ * The same table of flat_hash_set, with std::pair< const Key_T, Mapped_T > values
+ * stored on the slots. See flat_hash_set for the layout and the search.
+ *
+ * \tparam Key_T Key type
+ * \tparam Mapped_T Mapped value type
+ * \tparam Hash_T Hash function object, the hash is mixed before splitting its bits
+ * \tparam KeyEqual_T Key comparison function object
+ * \tparam Tag_T Instruction set of the control byte groups
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <string>
+ * #include <litesimd/container.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::flat_hash_map< std::string, int > ages;
+ *     ages[ "alice" ] = 31;
+ *     ages[ "bob" ] = 27;
+ *     ages.insert( std::make_pair( "alice", 40 ) );
+ *     ++ages[ "bob" ];
+ *
+ *     std::cout << "alice: " << ages.find( "alice" )->second << std::endl
+ *               << "bob: " << ages[ "bob" ] << std::endl
+ *               << "size(): " << ages.size() << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * alice: 31
+ * bob: 28
+ * size(): 2
+ * ```
+ */
+template< typename Key_T, typename Mapped_T, typename Hash_T = std::hash< Key_T >,
+          typename KeyEqual_T = std::equal_to< Key_T >, typename Tag_T = default_tag >
+class flat_hash_map
+    : public detail::hash_table< std::pair< const Key_T, Mapped_T >, Key_T, detail::hash_key_first,
+                                 Hash_T, KeyEqual_T, Tag_T, true >
+{
+    using base = detail::hash_table< std::pair< const Key_T, Mapped_T >, Key_T, detail::hash_key_first,
+                                     Hash_T, KeyEqual_T, Tag_T, true >;
+
+public:
+    using mapped_type = Mapped_T;
+
+    using base::base;
+    using base::insert;
+
+    /// Empty map
+    flat_hash_map() = default;
+
+    /**
+     * \brief Inserts a pair converted to the value type
+     *
+     * \param value Pair with the key and the mapped value
+     * \returns Pair with the iterator to the value with the key and true when the
+     * value was inserted
+     */
+    template< typename Pair_T, typename std::enable_if<
+                  std::is_constructible< typename base::value_type, Pair_T&& >::value >::type* = nullptr >
+    std::pair< typename base::iterator, bool > insert( Pair_T&& value )
+    {
+        return insert( typename base::value_type( std::forward< Pair_T >( value ) ) );
+    }
+
+    /**
+     * \brief Inserts a value built from the key and the arguments, when the map has no
+     * value with the key
+     *
+     * The mapped value is built only when the key is inserted.
+     *
+     * \param key Key to insert
+     * \param args Arguments of the constructor of the mapped value
+     * \returns Pair with the iterator to the value with the key and true when the
+     * value was inserted
+     */
+    template< typename... Args_T >
+    std::pair< typename base::iterator, bool > try_emplace( const Key_T& key, Args_T&&... args )
+    {
+        return this->emplace_key( key, std::piecewise_construct, std::forward_as_tuple( key ),
+                                  std::forward_as_tuple( std::forward< Args_T >( args )... ) );
+    }
+
+    /**
+     * \brief Returns the mapped value of the key, inserting a default one when the map
+     * has no value with the key
+     *
+     * \param key Key to search
+     * \returns Reference to the mapped value
+     */
+    Mapped_T& operator[]( const Key_T& key )
+    {
+        return try_emplace( key ).first->second;
+    }
+};
+
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_FLAT_HASH_MAP_H
@@ -0,0 +1,114 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_FLAT_HASH_SET_H
+#define LITESIMD_CONTAINER_FLAT_HASH_SET_H
+
+#include <functional>
+#include <litesimd/types.h>
+#include <litesimd/container/detail/hash_table.h>
+
+namespace litesimd {
+
+/**
+ * \ingroup container
+ * \brief Unordered set of keys on an open addressing hash table, with the slots searched
+ * by groups of SIMD control bytes.
+ *
+ * Each slot has a control byte with the 7 low bits of the hash of its key, or the
+ * empty or deleted markers. The slots are split on groups of one SIMD register of
+ * control bytes, 16 slots on SSE and 32 on AVX. A search compares the tag of the key
+ * with all control bytes of the group at once, with equal_to_bitmask, and compares the
+ * keys only on the matching slots. A group with an empty slot ends the search, so most
+ * searches read one group of control bytes and one slot, hitting or missing.
+ *
+ * The erase leaves a deleted slot on the full groups. The table grows when 7/8 of the
+ * slots are used, counting the deleted ones, and the rehash drops the deleted slots.
+ * The iterators are invalidated by the insertions, as on std::unordered_set.
+ *
+ * find_many searches a batch of keys prefetching the groups of the keys, which is faster
+ * than a loop of find on tables larger than the cache.
+ *
+ * \tparam Key_T Key type
+ * \tparam Hash_T Hash function object, the hash is mixed before splitting its bits
+ * \tparam KeyEqual_T Key comparison function object
+ * \tparam Tag_T Instruction set of the control byte groups
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/container.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::flat_hash_set< int32_t > set;
+ *     for( int32_t i = 0; i < 1000; ++i )
+ *         set.insert( i * 3 );
+ *     set.erase( 300 );
+ *
+ *     std::cout << "size(): " << set.size() << std::endl
+ *               << "contains( 297 ): " << set.contains( 297 ) << std::endl
+ *               << "contains( 298 ): " << set.contains( 298 ) << std::endl
+ *               << "contains( 300 ): " << set.contains( 300 ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * size(): 999
+ * contains( 297 ): 1
+ * contains( 298 ): 0
+ * contains( 300 ): 0
+ * ```
+ */
+template< typename Key_T, typename Hash_T = std::hash< Key_T >,
+          typename KeyEqual_T = std::equal_to< Key_T >, typename Tag_T = default_tag >
+class flat_hash_set
+    : public detail::hash_table< Key_T, Key_T, detail::hash_key_identity, Hash_T, KeyEqual_T, Tag_T, false >
+{
+    using base = detail::hash_table< Key_T, Key_T, detail::hash_key_identity, Hash_T, KeyEqual_T, Tag_T, false >;
+
+public:
+    using base::base;
+
+    /// Empty set
+    flat_hash_set() = default;
+
+    /**
+     * \brief Inserts a key built from the arguments
+     *
+     * \param args Arguments of the constructor of the key
+     * \returns Pair with the iterator to the key and true when the key was inserted
+     */
+    template< typename... Args_T >
+    std::pair< typename base::iterator, bool > emplace( Args_T&&... args )
+    {
+        Key_T key( std::forward< Args_T >( args )... );
+        return this->emplace_key( key, std::move( key ) );
+    }
+};
+
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_FLAT_HASH_SET_H
@@ -0,0 +1,330 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_LEARNED_INDEX_H
+#define LITESIMD_CONTAINER_LEARNED_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <litesimd/types.h>
+#include <litesimd/compare.h>
+#include <litesimd/algorithm/binary_search.h>
+#include <litesimd/helpers/containers.h>
+#include <litesimd/container/static_search_tree.h>
+#include <litesimd/container/detail/search_node.h>
+
+namespace litesimd {
+
+namespace detail {
+
+// Distance from base to key as double. The integers are subtracted before the conversion,
+// as the large 64 bits keys do not fit on the double mantissa.
+template< typename Key_T >
+inline double learned_key_delta( Key_T key, Key_T base, std::true_type )
+{
+    using traits = search_traits< Key_T >;
+    using unsigned_type = typename traits::unsigned_type;
+    return static_cast< double >( static_cast< unsigned_type >( traits::to( key ) )
+                                  - static_cast< unsigned_type >( traits::to( base ) ) );
+}
+
+template< typename Key_T >
+inline double learned_key_delta( Key_T key, Key_T base, std::false_type )
+{
+    return static_cast< double >( key ) - static_cast< double >( base );
+}
+
+} // namespace detail
+
+/**
+ * \ingroup container
+ * \brief Read only sorted set of keys indexed by a piecewise linear model, with a SIMD
+ * search of the last mile.
+ *
+ * The keys are split on segments where a line predicts the position of each key with
+ * at most `error` positions of difference, as on the PGM index. The segments are fitted
+ * on one pass over the keys with a shrinking cone: each new key narrows the slopes which
+ * keep all keys of the segment inside the error, and starts a new segment when none is
+ * left. A search finds the segment of the key on a static_search_tree of the first keys
+ * of the segments, predicts the position and counts the keys less than the key on a
+ * window of three cache lines around the prediction, with greater_node_bitmask and
+ * bit_count.
+ *
+ * On smooth key distributions, like timestamps or sequence ids, a few segments cover
+ * millions of keys, so the index takes a tiny fraction of the memory of a search tree
+ * and the search reads only the window of the keys. On uniform random keys the segments
+ * have about a hundred keys each, the search of the segment costs as much as the search
+ * of a static_search_tree, and the tree is faster.
+ *
+ * The error bound is on the distinct keys. Past long runs of repeated keys, when all
+ * keys of the window are less than the key, the search goes on with
+ * litesimd::lower_bound up to the end of the segment.
+ *
+ * Signed and unsigned integers, float and double keys of 32 and 64 bits are supported.
+ *
+ * \tparam Key_T Key type
+ * \tparam Tag_T Instruction set used on the searches
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/container.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     // Timestamps, one each 10 seconds with some jitter
+ *     std::vector< int64_t > values;
+ *     for( int64_t i = 0; i < 1000000; ++i )
+ *         values.push_back( 1500000000 + i * 10 + (i * 7) % 5 );
+ *
+ *     ls::learned_index< int64_t > index( values.begin(), values.end() );
+ *
+ *     auto it = index.lower_bound( 1500000501 );
+ *     std::cout << "segments(): " << index.segments() << std::endl
+ *               << "lower_bound( 1500000501 ): " << *it << " at " << (it - index.begin()) << std::endl
+ *               << "contains( 1500000503 ): " << index.contains( 1500000503 ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * segments(): 1
+ * lower_bound( 1500000501 ): 1500000512 at 51
+ * contains( 1500000503 ): 0
+ * ```
+ */
+template< typename Key_T, typename Tag_T = default_tag >
+class learned_index
+{
+    static_assert( detail::is_searchable< Key_T >::value && sizeof( Key_T ) >= sizeof( int32_t ),
+                   "learned_index supports only 32 and 64 bits integer, float and double keys" );
+
+    using traits = detail::search_traits< Key_T >;
+    using search_type = typename traits::type;
+    using simd = simd_type< search_type, Tag_T >;
+
+    // Keys on a cache line, the windows start on them
+    constexpr static size_t line_size = detail::search_tree_node_bytes / sizeof( Key_T );
+
+public:
+    using key_type        = Key_T;
+    using value_type      = Key_T;
+    using size_type       = size_t;
+    using const_reference = const Key_T&;
+    using const_iterator  = const Key_T*;
+    using iterator        = const_iterator;
+
+    /// Maximum distance from the predicted position to the position of a key
+    constexpr static size_t error = line_size;
+
+    /// Keys compared by the last mile search
+    constexpr static size_t window_size = 3 * line_size;
+
+    /// Empty index
+    learned_index() : size_( 0 ) {}
+
+    /**
+     * \brief Builds the index from a sorted range
+     *
+     * \param first, last Sorted range of keys
+     */
+    template< typename Iterator_T >
+    learned_index( Iterator_T first, Iterator_T last )
+        : size_( static_cast< size_t >( std::distance( first, last ) ) )
+    {
+        // The windows may read up to window_size keys past the last one
+        keys_.reserve( size_ + window_size );
+        keys_.assign( first, last );
+        keys_.resize( size_ + window_size, detail::search_node_pad< Key_T >() );
+        fit();
+    }
+
+    /// Iterator to the first key
+    const_iterator begin() const { return keys_.data(); }
+
+    /// Iterator past the last key
+    const_iterator end() const { return begin() + size_; }
+
+    /// Number of keys
+    size_t size() const { return size_; }
+
+    /// True when the index has no keys
+    bool empty() const { return size_ == 0; }
+
+    /// Number of segments of the model
+    size_t segments() const { return segments_.size(); }
+
+    /// Approximate bytes used by the model, without the keys and the upper levels of the segment tree
+    size_t index_bytes() const
+    {
+        return segments_.size() * (sizeof( segment ) + sizeof( Key_T ));
+    }
+
+    /**
+     * \brief Returns the first key not less than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key not less than key, or end()
+     */
+    const_iterator lower_bound( const Key_T& key ) const
+    {
+        if( empty() || !(keys_[ 0 ] < key) )
+            return begin();
+
+        // The first key of the segment is less than the key
+        size_t s = static_cast< size_t >( segment_keys_.upper_bound( key ) - segment_keys_.begin() ) - 1;
+        size_t last = (s + 1 < segments_.size()) ? segments_[ s + 1 ].pos : size_;
+        size_t pos = predict( s, last, key );
+
+        size_t window = ((pos > error) ? pos - error : 0) & ~(line_size - 1);
+        size_t count = detail::search_key_count< Tag_T, window_size, false >(
+                            begin() + window, simd( traits::to( key ) ), std::is_unsigned< Key_T >() );
+        if( count == window_size && window + window_size < last )
+            return litesimd::lower_bound< Tag_T >( begin() + window + window_size, begin() + last, key );
+
+        return begin() + std::min( window + count, size_ );
+    }
+
+    /**
+     * \brief Returns the first key greater than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key greater than key, or end()
+     */
+    const_iterator upper_bound( const Key_T& key ) const
+    {
+        const_iterator it = lower_bound( key );
+        return (it != end() && !(key < *it)) ? litesimd::upper_bound< Tag_T >( it, end(), key ) : it;
+    }
+
+    /**
+     * \brief Finds a key equal to key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key equal to key, or end() when not found
+     */
+    const_iterator find( const Key_T& key ) const
+    {
+        const_iterator it = lower_bound( key );
+        return (it != end() && !(key < *it)) ? it : end();
+    }
+
+    /**
+     * \brief Checks if the index has a key equal to key
+     *
+     * \param key Key to search
+     * \returns True when the key was found
+     */
+    bool contains( const Key_T& key ) const
+    {
+        return find( key ) != end();
+    }
+
+private:
+    struct segment
+    {
+        double slope;
+        size_t pos;   // Position of the first key of the segment
+    };
+
+    size_t size_;
+    vector< Key_T > keys_;
+    std::vector< segment > segments_;
+    static_search_tree< Key_T, Tag_T > segment_keys_;
+
+    static double delta( Key_T key, Key_T base )
+    {
+        return detail::learned_key_delta( key, base, std::is_integral< Key_T >() );
+    }
+
+    // Predicted position of the key on the segment s, which ends at last
+    size_t predict( size_t s, size_t last, const Key_T& key ) const
+    {
+        const segment& seg = segments_[ s ];
+        double offset = seg.slope * delta( key, keys_[ seg.pos ] );
+
+        // Past the last key of the segment and the NaN of the infinite keys
+        double length = static_cast< double >( last - seg.pos );
+        offset = (offset < length) ? offset : length;
+        return seg.pos + ((offset > 0.0) ? static_cast< size_t >( offset ) : 0);
+    }
+
+    void fit()
+    {
+        // The rounding down of the prediction adds up to one position of error
+        constexpr double fit_error = static_cast< double >( error ) - 1.0;
+
+        std::vector< Key_T > first_keys;
+        for( size_t i = 0; i < size_; )
+        {
+            // Slopes which keep all keys of the segment inside the error
+            double low = 0.0;
+            double high = std::numeric_limits< double >::infinity();
+            size_t j = i + 1;
+            for( ; j < size_; ++j )
+            {
+                // Only the first key of the repeated keys is fitted
+                if( !(keys_[ j - 1 ] < keys_[ j ]) )
+                    continue;
+
+                double dx = delta( keys_[ j ], keys_[ i ] );
+                double dy = static_cast< double >( j - i );
+                if( !(dx < std::numeric_limits< double >::infinity()) )
+                    break;
+
+                double new_low = std::max( low, (dy - fit_error) / dx );
+                double new_high = std::min( high, (dy + fit_error) / dx );
+                if( new_low > new_high )
+                    break;
+
+                low = new_low;
+                high = new_high;
+            }
+
+            segment seg;
+            seg.slope = (high < std::numeric_limits< double >::infinity()) ? (low + high) / 2.0 : 0.0;
+            seg.pos = i;
+            segments_.push_back( seg );
+            first_keys.push_back( keys_[ i ] );
+            i = j;
+        }
+        segment_keys_ = static_search_tree< Key_T, Tag_T >( first_keys.begin(), first_keys.end() );
+    }
+};
+
+template< typename Key_T, typename Tag_T >
+constexpr size_t learned_index< Key_T, Tag_T >::error;
+
+template< typename Key_T, typename Tag_T >
+constexpr size_t learned_index< Key_T, Tag_T >::window_size;
+
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_LEARNED_INDEX_H
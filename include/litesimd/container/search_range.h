@@ -0,0 +1,64 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_SEARCH_RANGE_H
+#define LITESIMD_CONTAINER_SEARCH_RANGE_H
+
+namespace litesimd {
+
+/**
+ * \ingroup container
+ * \brief Lazy range of the keys of a container between two bounds
+ *
+ * Returned by the `range( lo, hi )` functions of the containers. Only the first key
+ * is searched when the range is created, the iterator compares the next register of
+ * keys with `hi` when it reaches the end of the keys already checked, so a range
+ * which is not fully iterated does not read the keys after the stop.
+ *
+ * \tparam Iterator_T Forward iterator of the container, its default value is the end
+ * of the range
+ */
+template< typename Iterator_T >
+class search_range
+{
+public:
+    using iterator       = Iterator_T;
+    using const_iterator = Iterator_T;
+
+    explicit search_range( Iterator_T first ) : first_( first ) {}
+
+    /// Iterator to the first key of the range
+    Iterator_T begin() const { return first_; }
+
+    /// Iterator past the last key of the range
+    Iterator_T end() const { return Iterator_T(); }
+
+    /// True when there is no key on the range
+    bool empty() const { return first_ == Iterator_T(); }
+
+private:
+    Iterator_T first_;
+};
+
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_SEARCH_RANGE_H
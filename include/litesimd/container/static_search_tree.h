@@ -0,0 +1,559 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_STATIC_SEARCH_TREE_H
+#define LITESIMD_CONTAINER_STATIC_SEARCH_TREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <cstring>
+#include <ostream>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <boost/align/aligned_allocator.hpp>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/compare.h>
+#include <litesimd/algorithm/binary_search.h>
+#include <litesimd/helpers/containers.h>
+#include <litesimd/container/search_range.h>
+#include <litesimd/container/detail/search_node.h>
+#include <litesimd/container/detail/parallel_for.h>
+
+namespace litesimd {
+
+namespace detail {
+
+// Size of the tree nodes, one cache line
+constexpr size_t search_tree_node_bytes = 64;
+
+// Cache line aligned allocator which leaves the keys uninitialized on resize, the
+// builders write all of them, each thread touching first its own pages
+template< typename Value_T >
+struct search_tree_allocator : boost::alignment::aligned_allocator< Value_T, search_tree_node_bytes >
+{
+    template< typename Other_T >
+    struct rebind
+    {
+        using other = search_tree_allocator< Other_T >;
+    };
+
+    search_tree_allocator() = default;
+
+    template< typename Other_T >
+    search_tree_allocator( const search_tree_allocator< Other_T >& ) {}
+
+    using boost::alignment::aligned_allocator< Value_T, search_tree_node_bytes >::construct;
+
+    template< typename Other_T >
+    void construct( Other_T* ptr )
+    {
+        ::new( static_cast< void* >( ptr ) ) Other_T;
+    }
+};
+
+// Level of the static tree, also stored on the level table of the saved trees
+struct search_tree_level
+{
+    uint64_t offset; // First key of the level on the tree data
+    uint64_t nodes;  // Number of nodes of the level
+};
+
+// Header of the saved static trees, followed by the level table and, on the next
+// 64 bytes boundary, by the keys of all levels. All offsets start at the header.
+struct search_tree_header
+{
+    char magic[ 8 ];
+    uint32_t version;
+    uint32_t key_size;
+    uint32_t key_kind;
+    uint32_t node_size;
+    uint64_t size;
+    uint64_t height;
+    uint64_t data_offset;
+    uint64_t reserved[ 2 ];
+};
+
+constexpr char search_tree_magic[ 8 ] = { 'L', 'S', 'S', 'T', 'R', 'E', 'E', '\0' };
+constexpr uint32_t search_tree_version = 1;
+
+// Signed integer, unsigned integer or floating point, checked with the key size when loaded
+template< typename Key_T >
+constexpr uint32_t search_tree_key_kind()
+{
+    return std::is_floating_point< Key_T >::value ? 2 : std::is_signed< Key_T >::value ? 0 : 1;
+}
+
+// Position of the bound of the key on the keys of a static tree, the leaves being its last
+// level. Shared by the trees and the views of the saved trees.
+template< typename Tag_T, bool Upper_T, typename Key_T >
+inline size_t search_tree_bound( const Key_T* data, const search_tree_level* levels,
+                                 size_t height, size_t size, const Key_T& key )
+{
+    using search_type = typename search_traits< Key_T >::type;
+    using simd = simd_type< search_type, Tag_T >;
+    constexpr size_t node_size = search_tree_node_bytes / sizeof( Key_T );
+
+    if( size == 0 )
+        return 0;
+
+    simd key_vec( search_traits< Key_T >::to( key ) );
+    const search_type* keys = reinterpret_cast< const search_type* >( data );
+    size_t node = 0;
+    for( size_t l = 0; l + 1 < height; ++l )
+    {
+        node = node * (node_size + 1) + search_node_count< Tag_T, node_size, Upper_T >(
+                            keys + levels[ l ].offset + node * node_size, key_vec );
+
+        // Only the padding keys lead to missing children, so the key is past all keys
+        if( node >= levels[ l + 1 ].nodes )
+            return size;
+    }
+
+    size_t pos = node * node_size + search_key_count< Tag_T, node_size, Upper_T >(
+                            data + levels[ height - 1 ].offset + node * node_size, key_vec,
+                            std::is_unsigned< Key_T >() );
+    return std::min( pos, size );
+}
+
+} // namespace detail
+
+/**
+ * \ingroup container
+ * \brief Read only sorted set of keys indexed by a static SIMD search tree.
+ *
+ * The tree is built once from a sorted range and keeps its own copy of the keys.
+ * Each node has one cache line of keys (16 int32, 8 int64, ...) and one child more
+ * than keys, the node key `i` being the smallest key below the child `i + 1`. All
+ * levels are stored on one 64 bytes aligned buffer, from the root to the leaves, and
+ * the leaves are the sorted keys themselves.
+ *
+ * A search reads one node per level and compares the key with all registers of the
+ * node at once with greater_node_bitmask, the child being the bit_count of the bitmask.
+ * So it touches one cache line per level instead of one per step of the binary search.
+ * The inner levels keep the keys mapped to the signed type, as the SIMD registers
+ * compare them. On large arrays this is several times faster than
+ * `std::lower_bound`.
+ *
+ * Signed and unsigned integers, float and double keys are supported. Repeated keys
+ * are allowed.
+ *
+ * \tparam Key_T Key type
+ * \tparam Tag_T Instruction set used on the searches
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <vector>
+ * #include <litesimd/container.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     std::vector< int32_t > values;
+ *     for( int32_t i = 0; i < 1000; ++i )
+ *         values.push_back( i * 2 );
+ *
+ *     ls::static_search_tree< int32_t > tree( values.begin(), values.end() );
+ *
+ *     auto it = tree.lower_bound( 501 );
+ *     std::cout << "lower_bound( 501 ): " << *it << " at " << (it - tree.begin()) << std::endl
+ *               << "contains( 502 ): " << tree.contains( 502 ) << std::endl
+ *               << "contains( 503 ): " << tree.contains( 503 ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * lower_bound( 501 ): 502 at 251
+ * contains( 502 ): 1
+ * contains( 503 ): 0
+ * ```
+ */
+template< typename Key_T, typename Tag_T = default_tag >
+class static_search_tree
+{
+    static_assert( detail::is_searchable< Key_T >::value,
+                   "static_search_tree supports only integer, float and double keys" );
+
+    using search_type = typename detail::search_traits< Key_T >::type;
+    using simd = simd_type< search_type, Tag_T >;
+
+public:
+    using key_type        = Key_T;
+    using value_type      = Key_T;
+    using size_type       = size_t;
+    using const_reference = const Key_T&;
+    using const_iterator  = const Key_T*;
+    using iterator        = const_iterator;
+
+    /// SIMD register of the keys given to the range callback, the unsigned keys are
+    /// kept as they are on the signed register of the same size
+    using register_type   = simd;
+
+    /// Keys on each node of the tree
+    constexpr static size_t node_size = detail::search_tree_node_bytes / sizeof( Key_T );
+
+    /// Forward iterator over the keys of a range, see range()
+    class range_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Key_T;
+        using difference_type   = ptrdiff_t;
+        using pointer           = const Key_T*;
+        using reference         = const Key_T&;
+
+        range_iterator() : pos_( nullptr ), limit_( nullptr ), last_( nullptr ) {}
+
+        reference operator*() const { return *pos_; }
+        pointer operator->() const { return pos_; }
+
+        range_iterator& operator++()
+        {
+            if( ++pos_ == limit_ )
+                next();
+            return *this;
+        }
+
+        range_iterator operator++( int )
+        {
+            range_iterator ret( *this );
+            ++*this;
+            return ret;
+        }
+
+        bool operator==( const range_iterator& rhs ) const { return pos_ == rhs.pos_; }
+        bool operator!=( const range_iterator& rhs ) const { return pos_ != rhs.pos_; }
+
+    private:
+        friend class static_search_tree;
+
+        range_iterator( const Key_T* pos, const Key_T* last, simd hi )
+            : pos_( pos ), limit_( pos ), last_( last ), hi_( hi )
+        {
+            next();
+        }
+
+        // Checks the keys from pos to the end of its register, the keys are sorted so
+        // the ones less than hi are the first ones
+        void next()
+        {
+            if( pos_ != last_ )
+            {
+                const Key_T* reg = detail::search_register< Tag_T >( pos_ );
+                uint32_t mask = detail::search_less_lanes< Tag_T >( reg, hi_ ) >> (pos_ - reg);
+                limit_ = pos_ + bit_count< Tag_T >( mask );
+            }
+            if( pos_ == last_ || pos_ == limit_ )
+                pos_ = limit_ = nullptr;
+        }
+
+        const Key_T* pos_;
+        const Key_T* limit_;
+        const Key_T* last_;
+        simd hi_;
+    };
+
+    /// Empty tree
+    static_search_tree() : size_( 0 ), leaves_( 0 ) {}
+
+    /**
+     * \brief Builds the tree from a sorted range
+     *
+     * \param first, last Sorted range of keys
+     */
+    template< typename Iterator_T >
+    static_search_tree( Iterator_T first, Iterator_T last )
+        : size_( 0 ), leaves_( 0 )
+    {
+        allocate( static_cast< size_t >( std::distance( first, last ) ) );
+        std::copy( first, last, data_.begin() + leaves_ );
+        build_levels( 1 );
+    }
+
+    /**
+     * \brief Builds the tree from a sorted range on several threads
+     *
+     * The levels are allocated once with their exact sizes, then each thread copies one
+     * part of the keys to the leaves and, once all leaves are done, fills one part of
+     * the nodes of each inner level. The threads write on separated cache lines and
+     * touch first their own pages, so the build scales with the number of cores until
+     * the memory bandwidth is over.
+     *
+     * \param first, last Sorted range of keys, with random access iterators
+     * \param threads Number of threads, 0 for one thread for each core
+     *
+     * **Example**
+     * ```{.cpp}
+     * ls::static_search_tree< int32_t > tree( values.begin(), values.end(), 0 );
+     * ```
+     */
+    template< typename Iterator_T >
+    static_search_tree( Iterator_T first, Iterator_T last, size_t threads )
+        : size_( 0 ), leaves_( 0 )
+    {
+        static_assert( std::is_base_of< std::random_access_iterator_tag,
+                           typename std::iterator_traits< Iterator_T >::iterator_category >::value,
+                       "The parallel build needs random access iterators" );
+
+        threads = detail::parallel_threads( threads );
+        allocate( static_cast< size_t >( last - first ) );
+        detail::parallel_for( levels_.empty() ? 0 : levels_.back().nodes, threads,
+                              [this, first]( size_t begin, size_t end ){
+            std::copy( first + std::min( begin * node_size, size_ ), first + std::min( end * node_size, size_ ),
+                       data_.begin() + leaves_ + begin * node_size );
+        });
+        build_levels( threads );
+    }
+
+    /// Iterator to the first key
+    const_iterator begin() const { return data_.data() + leaves_; }
+
+    /// Iterator past the last key
+    const_iterator end() const { return begin() + size_; }
+
+    /// Number of keys
+    size_t size() const { return size_; }
+
+    /// True when the tree has no keys
+    bool empty() const { return size_ == 0; }
+
+    /// Levels of the tree, including the leaves
+    size_t height() const { return levels_.size(); }
+
+    /**
+     * \brief Returns the first key not less than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key not less than key, or end()
+     */
+    const_iterator lower_bound( const Key_T& key ) const
+    {
+        return bound< false >( key );
+    }
+
+    /**
+     * \brief Returns the first key greater than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key greater than key, or end()
+     */
+    const_iterator upper_bound( const Key_T& key ) const
+    {
+        return bound< true >( key );
+    }
+
+    /**
+     * \brief Finds a key equal to key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key equal to key, or end() when not found
+     */
+    const_iterator find( const Key_T& key ) const
+    {
+        const_iterator it = lower_bound( key );
+        return (it != end() && !(key < *it)) ? it : end();
+    }
+
+    /**
+     * \brief Checks if the tree has a key equal to key
+     *
+     * \param key Key to search
+     * \returns True when the key was found
+     */
+    bool contains( const Key_T& key ) const
+    {
+        return find( key ) != end();
+    }
+
+    /**
+     * \brief Lazy range of the keys in [lo, hi)
+     *
+     * The tree is descended once for lo. The iterators compare the following keys with
+     * hi one SIMD register at a time, only when they get to that register.
+     *
+     * \param lo, hi Bounds of the range, hi is not included
+     * \returns Range with the keys not less than lo and less than hi
+     */
+    search_range< range_iterator > range( const Key_T& lo, const Key_T& hi ) const
+    {
+        return search_range< range_iterator >( range_iterator( lower_bound( lo ), end(),
+                                               simd( detail::search_traits< Key_T >::to( hi ) ) ) );
+    }
+
+    /**
+     * \brief Calls the function for each SIMD register of keys with keys in [lo, hi)
+     *
+     * The tree is descended once for lo and the following registers of keys are
+     * compared with hi until the first key not less than hi. The function receives
+     * each register and the lane bitmask of its keys inside the range, the bit `i` set
+     * for the key of index `i`.
+     *
+     * \param lo, hi Bounds of the range, hi is not included
+     * \param func Function called as `func( register_type keys, uint32_t bitmask )`
+     *
+     * **Example**
+     * ```{.cpp}
+     * // Number of keys in [lo, hi)
+     * size_t count = 0;
+     * tree.range( lo, hi, [&]( decltype( tree )::register_type, uint32_t bitmask ){
+     *     count += ls::bit_count( bitmask );
+     * });
+     * ```
+     */
+    template< typename Function_T >
+    void range( const Key_T& lo, const Key_T& hi, Function_T func ) const
+    {
+        const Key_T* pos = lower_bound( lo );
+        if( pos == end() )
+            return;
+
+        simd hi_vec( detail::search_traits< Key_T >::to( hi ) );
+        const Key_T* reg = detail::search_register< Tag_T >( pos );
+        uint32_t mask = detail::search_less_lanes< Tag_T >( reg, hi_vec ) & (~0u << (pos - reg));
+        while( mask != 0 )
+        {
+            func( load< search_type, Tag_T >( reinterpret_cast< const search_type* >( reg ) ), mask );
+
+            // The padding after the last key is never in the range
+            reg += simd::simd_size;
+            if( (mask >> (simd::simd_size - 1)) == 0 || reg >= end() )
+                return;
+            mask = detail::search_less_lanes< Tag_T >( reg, hi_vec );
+        }
+    }
+
+    /**
+     * \brief Writes the tree on a flat, position independent format
+     *
+     * The output has a header, the level table and, on the next 64 bytes boundary, the
+     * keys of all levels as they are on the memory. Once written, it can be mapped
+     * read only, for example with `mmap`, and searched in place by
+     * static_search_tree_view, without rebuilding the tree. The format uses the byte
+     * order of the machine.
+     *
+     * \param out Binary output stream
+     * \returns The stream
+     *
+     * \see static_search_tree_view
+     */
+    std::ostream& save( std::ostream& out ) const
+    {
+        detail::search_tree_header header;
+        std::memset( &header, 0, sizeof( header ) );
+        std::memcpy( header.magic, detail::search_tree_magic, sizeof( header.magic ) );
+        header.version = detail::search_tree_version;
+        header.key_size = sizeof( Key_T );
+        header.key_kind = detail::search_tree_key_kind< Key_T >();
+        header.node_size = node_size;
+        header.size = size_;
+        header.height = levels_.size();
+
+        size_t table = sizeof( header ) + levels_.size() * sizeof( detail::search_tree_level );
+        header.data_offset = (table + detail::search_tree_node_bytes - 1) & ~(detail::search_tree_node_bytes - 1);
+
+        static const char padding[ detail::search_tree_node_bytes ] = {};
+        out.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+        out.write( reinterpret_cast< const char* >( levels_.data() ),
+                   levels_.size() * sizeof( detail::search_tree_level ) );
+        out.write( padding, header.data_offset - table );
+        return out.write( reinterpret_cast< const char* >( data_.data() ), data_.size() * sizeof( Key_T ) );
+    }
+
+private:
+    size_t size_;
+    size_t leaves_;
+    std::vector< detail::search_tree_level > levels_;
+    std::vector< Key_T, detail::search_tree_allocator< Key_T > > data_;
+
+    template< bool Upper_T >
+    const_iterator bound( const Key_T& key ) const
+    {
+        return begin() + detail::search_tree_bound< Tag_T, Upper_T >(
+                            data_.data(), levels_.data(), levels_.size(), size_, key );
+    }
+
+    // Sizes the levels, only the padding after the last key is written
+    void allocate( size_t size )
+    {
+        size_ = size;
+        if( size_ == 0 )
+            return;
+
+        // Nodes of each level, from the leaves to the root
+        std::vector< size_t > nodes( 1, (size_ + node_size - 1) / node_size );
+        while( nodes.back() > 1 )
+            nodes.push_back( (nodes.back() + node_size) / (node_size + 1) );
+
+        levels_.resize( nodes.size() );
+        size_t offset = 0;
+        for( size_t l = 0; l < nodes.size(); ++l )
+        {
+            levels_[ l ].offset = offset;
+            levels_[ l ].nodes = nodes[ nodes.size() - l - 1 ];
+            offset += levels_[ l ].nodes * node_size;
+        }
+        leaves_ = levels_.back().offset;
+        data_.resize( offset );
+        std::fill( data_.begin() + leaves_ + size_, data_.end(), detail::search_node_pad< Key_T >() );
+    }
+
+    // Fills the inner levels from the leaves, the nodes of each level split among the threads
+    void build_levels( size_t threads )
+    {
+        // The key i of the node n is the first key below its child (n * (node_size + 1) + i + 1),
+        // that is the first key of the leaf (n * (node_size + 1) + i + 1) * (node_size + 1)^depth
+        size_t leaves_per_child = 1;
+        for( size_t l = levels_.size(); l-- > 1; )
+        {
+            Key_T* level = data_.data() + levels_[ l - 1 ].offset;
+            detail::parallel_for( levels_[ l - 1 ].nodes, threads,
+                                  [this, level, leaves_per_child]( size_t begin, size_t end ){
+                const Key_T pad = static_cast< Key_T >( detail::search_traits< Key_T >::to(
+                                        detail::search_node_pad< Key_T >() ) );
+                for( size_t n = begin; n < end; ++n )
+                {
+                    for( size_t i = 0; i < node_size; ++i )
+                    {
+                        size_t leaf = (n * (node_size + 1) + i + 1) * leaves_per_child;
+                        level[ n * node_size + i ] = (leaf * node_size < size_)
+                            ? static_cast< Key_T >( detail::search_traits< Key_T >::to( data_[ leaves_ + leaf * node_size ] ) )
+                            : pad;
+                    }
+                }
+            });
+            leaves_per_child *= node_size + 1;
+        }
+    }
+};
+
+template< typename Key_T, typename Tag_T >
+constexpr size_t static_search_tree< Key_T, Tag_T >::node_size;
+
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_STATIC_SEARCH_TREE_H
@@ -0,0 +1,247 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_CONTAINER_STATIC_SEARCH_TREE_VIEW_H
+#define LITESIMD_CONTAINER_STATIC_SEARCH_TREE_VIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <litesimd/types.h>
+#include <litesimd/container/static_search_tree.h>
+
+namespace litesimd {
+
+/**
+ * \ingroup container
+ * \brief Read only view of a static_search_tree saved by static_search_tree::save
+ *
+ * The view searches the saved tree in place, usually a read only file mapping, without
+ * copying or rebuilding anything. So a large index is ready as soon as it is mapped, and
+ * the mapping is shared by all processes through the page cache. The buffer must
+ * outlive the view and start on a 64 bytes boundary, which all page aligned mappings do.
+ *
+ * When the buffer is not a tree saved with the same key type and node size, or it is
+ * truncated or misaligned, the view is empty and valid() is false.
+ *
+ * \tparam Key_T Key type, the same of the saved tree
+ * \tparam Tag_T Instruction set used on the searches, it may differ of the saved tree
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <fstream>
+ * #include <vector>
+ * #include <boost/interprocess/file_mapping.hpp>
+ * #include <boost/interprocess/mapped_region.hpp>
+ * #include <litesimd/container.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *     namespace bip = boost::interprocess;
+ *
+ *     std::vector< int32_t > values;
+ *     for( int32_t i = 0; i < 1000; ++i )
+ *         values.push_back( i * 2 );
+ *
+ *     {
+ *         std::ofstream out( "tree.bin", std::ios::binary );
+ *         ls::static_search_tree< int32_t >( values.begin(), values.end() ).save( out );
+ *     }
+ *
+ *     bip::file_mapping file( "tree.bin", bip::read_only );
+ *     bip::mapped_region region( file, bip::read_only );
+ *     ls::static_search_tree_view< int32_t > tree( region.get_address(), region.get_size() );
+ *
+ *     auto it = tree.lower_bound( 501 );
+ *     std::cout << "valid(): " << tree.valid() << std::endl
+ *               << "lower_bound( 501 ): " << *it << " at " << (it - tree.begin()) << std::endl
+ *               << "contains( 503 ): " << tree.contains( 503 ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output
+ * ```
+ * valid(): 1
+ * lower_bound( 501 ): 502 at 251
+ * contains( 503 ): 0
+ * ```
+ *
+ * \see static_search_tree
+ */
+template< typename Key_T, typename Tag_T = default_tag >
+class static_search_tree_view
+{
+    static_assert( detail::is_searchable< Key_T >::value,
+                   "static_search_tree_view supports only integer, float and double keys" );
+
+public:
+    using key_type        = Key_T;
+    using value_type      = Key_T;
+    using size_type       = size_t;
+    using const_reference = const Key_T&;
+    using const_iterator  = const Key_T*;
+    using iterator        = const_iterator;
+
+    /// Keys on each node of the tree
+    constexpr static size_t node_size = static_search_tree< Key_T, Tag_T >::node_size;
+
+    /// Empty and invalid view
+    static_search_tree_view()
+        : data_( nullptr ), levels_( nullptr ), height_( 0 ), size_( 0 ), leaves_( 0 ), valid_( false ) {}
+
+    /**
+     * \brief Views a saved tree
+     *
+     * Only the header and the level table are checked, the keys are used as they are.
+     *
+     * \param buffer Saved tree, aligned to 64 bytes
+     * \param bytes Size of the buffer
+     */
+    static_search_tree_view( const void* buffer, size_t bytes )
+        : static_search_tree_view()
+    {
+        open( static_cast< const char* >( buffer ), bytes );
+    }
+
+    /// True when the buffer has a tree of this key type
+    bool valid() const { return valid_; }
+
+    /// Iterator to the first key
+    const_iterator begin() const { return data_ + leaves_; }
+
+    /// Iterator past the last key
+    const_iterator end() const { return begin() + size_; }
+
+    /// Number of keys
+    size_t size() const { return size_; }
+
+    /// True when the tree has no keys
+    bool empty() const { return size_ == 0; }
+
+    /// Levels of the tree, including the leaves
+    size_t height() const { return height_; }
+
+    /**
+     * \brief Returns the first key not less than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key not less than key, or end()
+     */
+    const_iterator lower_bound( const Key_T& key ) const
+    {
+        return begin() + detail::search_tree_bound< Tag_T, false >( data_, levels_, height_, size_, key );
+    }
+
+    /**
+     * \brief Returns the first key greater than key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key greater than key, or end()
+     */
+    const_iterator upper_bound( const Key_T& key ) const
+    {
+        return begin() + detail::search_tree_bound< Tag_T, true >( data_, levels_, height_, size_, key );
+    }
+
+    /**
+     * \brief Finds a key equal to key
+     *
+     * \param key Key to search
+     * \returns Iterator to the first key equal to key, or end() when not found
+     */
+    const_iterator find( const Key_T& key ) const
+    {
+        const_iterator it = lower_bound( key );
+        return (it != end() && !(key < *it)) ? it : end();
+    }
+
+    /**
+     * \brief Checks if the tree has a key equal to key
+     *
+     * \param key Key to search
+     * \returns True when the key was found
+     */
+    bool contains( const Key_T& key ) const
+    {
+        return find( key ) != end();
+    }
+
+private:
+    const Key_T* data_;
+    const detail::search_tree_level* levels_;
+    size_t height_;
+    size_t size_;
+    size_t leaves_;
+    bool valid_;
+
+    void open( const char* buffer, size_t bytes )
+    {
+        detail::search_tree_header header;
+        if( buffer == nullptr || bytes < sizeof( header ) ||
+            reinterpret_cast< uintptr_t >( buffer ) % detail::search_tree_node_bytes != 0 )
+            return;
+
+        std::memcpy( &header, buffer, sizeof( header ) );
+        if( std::memcmp( header.magic, detail::search_tree_magic, sizeof( header.magic ) ) != 0 ||
+            header.version != detail::search_tree_version ||
+            header.key_size != sizeof( Key_T ) ||
+            header.key_kind != detail::search_tree_key_kind< Key_T >() ||
+            header.node_size != node_size ||
+            header.data_offset % detail::search_tree_node_bytes != 0 ||
+            header.height > (bytes - sizeof( header )) / sizeof( detail::search_tree_level ) ||
+            header.data_offset < sizeof( header ) + header.height * sizeof( detail::search_tree_level ) ||
+            header.data_offset > bytes )
+            return;
+
+        // The levels follow each other up to the leaves, which have all keys
+        const detail::search_tree_level* levels =
+            reinterpret_cast< const detail::search_tree_level* >( buffer + sizeof( header ) );
+        uint64_t keys = 0;
+        for( size_t l = 0; l < header.height; ++l )
+        {
+            if( levels[ l ].offset != keys || levels[ l ].nodes == 0 ||
+                levels[ l ].nodes > (bytes - header.data_offset) / detail::search_tree_node_bytes )
+                return;
+            keys += levels[ l ].nodes * node_size;
+        }
+        if( (header.height == 0) != (header.size == 0) ||
+            keys > (bytes - header.data_offset) / sizeof( Key_T ) ||
+            (header.height > 0 && header.size > levels[ header.height - 1 ].nodes * node_size) )
+            return;
+
+        data_ = reinterpret_cast< const Key_T* >( buffer + header.data_offset );
+        levels_ = levels;
+        height_ = header.height;
+        size_ = header.size;
+        leaves_ = (height_ > 0) ? levels[ height_ - 1 ].offset : 0;
+        valid_ = true;
+    }
+};
+
+template< typename Key_T, typename Tag_T >
+constexpr size_t static_search_tree_view< Key_T, Tag_T >::node_size;
+
+} // namespace litesimd
+
+#endif // LITESIMD_CONTAINER_STATIC_SEARCH_TREE_VIEW_H
@@ -73,6 +73,36 @@ max< int64_t, avx_tag >( simd_type< int64_t, avx_tag > lhs, simd_type< int64_t,
     return blend< int64_t, avx_tag >( mask, lhs, rhs );
 }
 
+// Widening sum
+// ---------------------------------------------------------------------------------------
+template<> inline simd_type< int64_t, avx_tag >
+widen_sum< int8_t, avx_tag >( simd_type< int8_t, avx_tag > vec )
+{
+    // sad against zero sums 8 unsigned bytes on each 64 bits lane, removes the bias after
+    __m256i bias = _mm256_set1_epi8( static_cast< char >( 0x80 ) );
+    __m256i sum = _mm256_sad_epu8( _mm256_xor_si256( vec, bias ), _mm256_setzero_si256() );
+    return _mm256_sub_epi64( sum, _mm256_set1_epi64x( 8 * 128 ) );
+}
+
+template<> inline simd_type< int64_t, avx_tag >
+widen_sum< int32_t, avx_tag >( simd_type< int32_t, avx_tag > vec )
+{
+    return _mm256_add_epi64( _mm256_cvtepi32_epi64( _mm256_castsi256_si128( vec ) ),
+                             _mm256_cvtepi32_epi64( _mm256_extracti128_si256( vec, 1 ) ) );
+}
+
+template<> inline simd_type< int64_t, avx_tag >
+widen_sum< int16_t, avx_tag >( simd_type< int16_t, avx_tag > vec )
+{
+    return widen_sum< int32_t, avx_tag >( _mm256_madd_epi16( vec, _mm256_set1_epi16( 1 ) ) );
+}
+
+template<> inline simd_type< int64_t, avx_tag >
+widen_sum< int64_t, avx_tag >( simd_type< int64_t, avx_tag > vec )
+{
+    return vec;
+}
+
 } // namespace litesimd
 
 #endif // LITESIMD_HAS_AVX
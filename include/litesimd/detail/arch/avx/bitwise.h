@@ -78,6 +78,21 @@ DEF_BIT_XOR( float,   _mm256_xor_ps )
 DEF_BIT_XOR( double,  _mm256_xor_pd )
 #undef DEF_BIT_XOR
 
+// Shifts
+// ---------------------------------------------------------------------------------------
+#define DEF_BIT_SHIFT( FUNC_T, TYPE_T, CMD ) \
+template<> inline simd_type< TYPE_T, avx_tag > \
+FUNC_T< TYPE_T, avx_tag >( simd_type< TYPE_T, avx_tag > vec, int count ) { \
+    return CMD( vec, _mm_cvtsi32_si128( count ) ); }
+
+DEF_BIT_SHIFT( bit_shift_left,  int16_t, _mm256_sll_epi16 )
+DEF_BIT_SHIFT( bit_shift_left,  int32_t, _mm256_sll_epi32 )
+DEF_BIT_SHIFT( bit_shift_left,  int64_t, _mm256_sll_epi64 )
+DEF_BIT_SHIFT( bit_shift_right, int16_t, _mm256_srl_epi16 )
+DEF_BIT_SHIFT( bit_shift_right, int32_t, _mm256_srl_epi32 )
+DEF_BIT_SHIFT( bit_shift_right, int64_t, _mm256_srl_epi64 )
+#undef DEF_BIT_SHIFT
+
 } // namespace litesimd
 
 #endif // LITESIMD_HAS_AVX
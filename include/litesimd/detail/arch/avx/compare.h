@@ -46,6 +46,26 @@ bit_scan_reverse< avx_tag >( uint32_t bitmask )
     return bit_scan_reverse< sse_tag >( bitmask );
 }
 
+template<> inline std::pair<int, bool>
+bit_scan_reverse< avx_tag >( uint64_t bitmask )
+{
+    return bit_scan_reverse< sse_tag >( bitmask );
+}
+
+// Bit count
+// ---------------------------------------------------------------------------------------
+template<> inline int
+bit_count< avx_tag >( uint32_t bitmask )
+{
+    return bit_count< sse_tag >( bitmask );
+}
+
+template<> inline int
+bit_count< avx_tag >( uint64_t bitmask )
+{
+    return bit_count< sse_tag >( bitmask );
+}
+
 // Mask to bitmask
 // ---------------------------------------------------------------------------------------
 #define DEF_MASK_TO_BITMASK( TYPE_T, CMD ) \
@@ -63,6 +83,45 @@ DEF_MASK_TO_BITMASK( double,  _mm256_movemask_pd )
 
 #undef DEF_MASK_TO_BITMASK
 
+// Mask to lane bitmask
+// ---------------------------------------------------------------------------------------
+template<> inline typename simd_type< int8_t, avx_tag >::bitmask_type
+mask_to_lane_bitmask< int8_t, avx_tag >( simd_type< int8_t, avx_tag > mask )
+{
+    return _mm256_movemask_epi8( mask );
+}
+
+template<> inline typename simd_type< int16_t, avx_tag >::bitmask_type
+mask_to_lane_bitmask< int16_t, avx_tag >( simd_type< int16_t, avx_tag > mask )
+{
+    return _mm_movemask_epi8( _mm_packs_epi16( _mm256_castsi256_si128( mask ),
+                                               _mm256_extracti128_si256( mask, 1 ) ) );
+}
+
+template<> inline typename simd_type< int32_t, avx_tag >::bitmask_type
+mask_to_lane_bitmask< int32_t, avx_tag >( simd_type< int32_t, avx_tag > mask )
+{
+    return _mm256_movemask_ps( _mm256_castsi256_ps( mask ) );
+}
+
+template<> inline typename simd_type< int64_t, avx_tag >::bitmask_type
+mask_to_lane_bitmask< int64_t, avx_tag >( simd_type< int64_t, avx_tag > mask )
+{
+    return _mm256_movemask_pd( _mm256_castsi256_pd( mask ) );
+}
+
+template<> inline typename simd_type< float, avx_tag >::bitmask_type
+mask_to_lane_bitmask< float, avx_tag >( simd_type< float, avx_tag > mask )
+{
+    return _mm256_movemask_ps( mask );
+}
+
+template<> inline typename simd_type< double, avx_tag >::bitmask_type
+mask_to_lane_bitmask< double, avx_tag >( simd_type< double, avx_tag > mask )
+{
+    return _mm256_movemask_pd( mask );
+}
+
 // Greater than
 // ---------------------------------------------------------------------------------------
 #define DEF_GREATER_THAN( TYPE_T, CMD ) \
@@ -0,0 +1,105 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ARCH_AVX_MEMORY_H
+#define LITESIMD_ARCH_AVX_MEMORY_H
+
+#ifdef LITESIMD_HAS_AVX
+
+#include <immintrin.h>
+#include <litesimd/types.h>
+#include <litesimd/detail/arch/common/memory.h>
+
+namespace litesimd {
+
+// Load
+// ---------------------------------------------------------------------------------------
+#define DEF_LOAD( TYPE_T, PTR_T, CMD ) \
+template<> inline simd_type< TYPE_T, avx_tag > \
+load< TYPE_T, avx_tag >( const TYPE_T* ptr ) { \
+    return CMD( reinterpret_cast< const PTR_T* >( ptr ) ); }
+
+DEF_LOAD( int8_t,  __m256i, _mm256_loadu_si256 )
+DEF_LOAD( int16_t, __m256i, _mm256_loadu_si256 )
+DEF_LOAD( int32_t, __m256i, _mm256_loadu_si256 )
+DEF_LOAD( int64_t, __m256i, _mm256_loadu_si256 )
+DEF_LOAD( float,   float,   _mm256_loadu_ps )
+DEF_LOAD( double,  double,  _mm256_loadu_pd )
+#undef DEF_LOAD
+
+// Store
+// ---------------------------------------------------------------------------------------
+#define DEF_STORE( TYPE_T, PTR_T, CMD ) \
+template<> inline void \
+store< TYPE_T, avx_tag >( TYPE_T* ptr, simd_type< TYPE_T, avx_tag > vec ) { \
+    CMD( reinterpret_cast< PTR_T* >( ptr ), vec ); }
+
+DEF_STORE( int8_t,  __m256i, _mm256_storeu_si256 )
+DEF_STORE( int16_t, __m256i, _mm256_storeu_si256 )
+DEF_STORE( int32_t, __m256i, _mm256_storeu_si256 )
+DEF_STORE( int64_t, __m256i, _mm256_storeu_si256 )
+DEF_STORE( float,   float,   _mm256_storeu_ps )
+DEF_STORE( double,  double,  _mm256_storeu_pd )
+#undef DEF_STORE
+
+// Non-temporal store
+// ---------------------------------------------------------------------------------------
+#define DEF_STREAM( TYPE_T, PTR_T, CMD ) \
+template<> inline void \
+stream< TYPE_T, avx_tag >( TYPE_T* ptr, simd_type< TYPE_T, avx_tag > vec ) { \
+    CMD( reinterpret_cast< PTR_T* >( ptr ), vec ); }
+
+DEF_STREAM( int8_t,  __m256i, _mm256_stream_si256 )
+DEF_STREAM( int16_t, __m256i, _mm256_stream_si256 )
+DEF_STREAM( int32_t, __m256i, _mm256_stream_si256 )
+DEF_STREAM( int64_t, __m256i, _mm256_stream_si256 )
+DEF_STREAM( float,   float,   _mm256_stream_ps )
+DEF_STREAM( double,  double,  _mm256_stream_pd )
+#undef DEF_STREAM
+
+// Gather
+// ---------------------------------------------------------------------------------------
+#define DEF_GATHER( TYPE_T, INDEX_T, PTR_T, CMD ) \
+template<> inline simd_type< TYPE_T, avx_tag > \
+gather< TYPE_T, avx_tag >( const TYPE_T* ptr, simd_type< INDEX_T, avx_tag > idx ) { \
+    return CMD( reinterpret_cast< const PTR_T* >( ptr ), idx, sizeof( TYPE_T ) ); }
+
+DEF_GATHER( int32_t, int32_t, int,       _mm256_i32gather_epi32 )
+DEF_GATHER( int64_t, int64_t, long long, _mm256_i64gather_epi64 )
+DEF_GATHER( float,   int32_t, float,     _mm256_i32gather_ps )
+DEF_GATHER( double,  int64_t, double,    _mm256_i64gather_pd )
+#undef DEF_GATHER
+
+template<> inline void stream_fence< avx_tag >()
+{
+    _mm_sfence();
+}
+
+template<> inline void prefetch< avx_tag >( const void* ptr )
+{
+    _mm_prefetch( static_cast< const char* >( ptr ), _MM_HINT_T0 );
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_HAS_AVX
+#endif // LITESIMD_ARCH_AVX_MEMORY_H
@@ -102,7 +102,7 @@ template<> struct traits<   float, avx_tag >{
     using simd_type = __m256;
     using bitmask_type = uint32_t;
     static inline simd_type zero() { return _mm256_setzero_ps(); }
-    static inline simd_type ones() { return _mm256_cmp_ps( zero(), zero(), _CMP_GT_OQ ); }
+    static inline simd_type ones() { return _mm256_cmp_ps( zero(), zero(), _CMP_EQ_OQ ); }
     static inline simd_type from_value( float v ) { return _mm256_set1_ps( v ); }
     static inline simd_type from_values( float v7, float v6, float v5, float v4,
                                          float v3, float v2, float v1, float v0 )
@@ -116,7 +116,7 @@ template<> struct traits<  double, avx_tag >{
     using simd_type = __m256d;
     using bitmask_type = uint32_t;
     static inline simd_type zero() { return _mm256_setzero_pd(); }
-    static inline simd_type ones() { return _mm256_cmp_pd( zero(), zero(), _CMP_GT_OQ ); }
+    static inline simd_type ones() { return _mm256_cmp_pd( zero(), zero(), _CMP_EQ_OQ ); }
     static inline simd_type from_value( double v ) { return _mm256_set1_pd( v ); }
     static inline simd_type from_values( double v3, double v2, double v1, double v0 )
     {
@@ -111,6 +111,45 @@ min( simd_type< ValueType_T, Tag_T > lhs, simd_type< ValueType_T, Tag_T > rhs ){
 template< typename ValueType_T, typename Tag_T > inline simd_type< ValueType_T, Tag_T >
 max( simd_type< ValueType_T, Tag_T > lhs, simd_type< ValueType_T, Tag_T > rhs ){}
 
+// Widening sum
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup algorithm
+ * \brief Sums the values inside the SIMD register into 64 bits partial sums.
+ *
+ * The values of the SIMD register are added in groups and each group sum is
+ * stored on one 64 bits value of the returned register, so the total can be
+ * accumulated without overflow. The sum of all values on the returned register
+ * is equal to the sum of all values on the original register.
+ *
+ * \param vec SIMD register to be summed
+ * \returns SIMD register with the 64 bits partial sums
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/algorithm.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *     ls::simd_type< int32_t, ls::sse_tag > a( 0x7fffffff, 0x7fffffff, -1, 3 );
+ *     std::cout << "widen_sum( a ): " << ls::widen_sum( a ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * widen_sum( a ): (2147483646, 2147483650)
+ * ```
+ *
+ * \see reduce_sum
+ */
+template< typename ValueType_T, typename Tag_T > inline simd_type< int64_t, Tag_T >
+widen_sum( simd_type< ValueType_T, Tag_T > vec ){}
+
 } // namespace litesimd
 
 #endif // LITESIMD_ARCH_COMMON_ALGORITHM_H
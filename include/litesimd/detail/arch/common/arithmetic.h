@@ -158,7 +158,8 @@ sub( simd_type< ValueType_T, Tag_T > lhs, simd_type< ValueType_T, Tag_T > rhs ){
  * mullo( a, b ): (32, 32, 32, 32, 32, 32, 32, 32)
  * ```
  *
- * \remarks This functions works only on int16_t and int32_t on Intel archtecture
+ * \remarks This functions works only on int16_t, int32_t, float and double on Intel archtecture.
+ * For float and double the result is the complete product.
  * \see mulhi
  */
 template< typename ValueType_T, typename Tag_T = default_tag >
@@ -215,6 +216,43 @@ template< typename ValueType_T, typename Tag_T = default_tag >
 simd_type< ValueType_T, Tag_T >
 div( simd_type< ValueType_T, Tag_T > lhs, simd_type< ValueType_T, Tag_T > rhs ){}
 
+/**
+ * \ingroup arithmetic
+ * \brief Converts each value inside the packed SIMD register to another type.
+ *
+ * Conversions from float to integer truncate the value towards zero.
+ * Only int32_t to float and float to int32_t are available for this function.
+ *
+ * \param vec SIMD register to be converted
+ * \tparam To_T Type of value inside the resulting packed SIMD register.
+ * \tparam From_T Type of value inside the source packed SIMD register.
+ * \tparam Tag_T Metaprogramming tag for instruction set selection.
+ * \returns SIMD register with the converted values
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/arithmetic.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *     ls::t_float_simd a( 4.7f, 3.2f, -2.5f, 1.0f );
+ *     std::cout << "convert< int32_t >( a ): " << ls::convert< int32_t >( a ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * convert< int32_t >( a ): (4, 3, -2, 1)
+ * ```
+ */
+template< typename To_T, typename From_T, typename Tag_T = default_tag >
+simd_type< To_T, Tag_T >
+convert( simd_type< From_T, Tag_T > vec ){}
+
 } // namespace litesimd
 
 #endif // LITESIMD_ARCH_COMMON_ARITHMETIC_H
@@ -161,6 +161,79 @@ bit_not( simd_type< ValueType_T, Tag_T > vec )
     return bit_xor( vec, simd_type< ValueType_T, Tag_T >::ones() );
 }
 
+// Shifts
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup bitwise
+ * \brief Shifts all values of the SIMD register to the left, inserting zeros.
+ *
+ * Only 16, 32 and 64 bits integers are supported.
+ *
+ * \param vec SIMD register to shift.
+ * \param count Number of bits to shift.
+ * \returns SIMD register with the values shifted.
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/bitwise.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::t_int32_simd a( 4, 3, 2, 1 );
+ *     std::cout << "bit_shift_left( a, 4 ): " << ls::bit_shift_left( a, 4 ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * bit_shift_left( a, 4 ): (64, 48, 32, 16)
+ * ```
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline simd_type< ValueType_T, Tag_T >
+bit_shift_left( simd_type< ValueType_T, Tag_T > vec, int count ){}
+
+/**
+ * \ingroup bitwise
+ * \brief Shifts all values of the SIMD register to the right, inserting zeros (logical shift).
+ *
+ * The values are shifted as unsigned integers, the sign bit is not extended.
+ * Only 16, 32 and 64 bits integers are supported.
+ *
+ * \param vec SIMD register to shift.
+ * \param count Number of bits to shift.
+ * \returns SIMD register with the values shifted.
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/bitwise.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::t_int32_simd a( 64, 48, 32, -16 );
+ *     std::cout << "bit_shift_right( a, 4 ): " << ls::bit_shift_right( a, 4 ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * bit_shift_right( a, 4 ): (4, 3, 2, 268435455)
+ * ```
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline simd_type< ValueType_T, Tag_T >
+bit_shift_right( simd_type< ValueType_T, Tag_T > vec, int count ){}
+
 } // namespace litesimd
 
 #endif // LITESIMD_ARCH_COMMON_BITWISE_H
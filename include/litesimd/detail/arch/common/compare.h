@@ -36,6 +36,35 @@ std::pair<int, bool> bit_scan_forward( uint32_t bitmask ){ return std::make_pair
 template< typename Tag_T = default_tag >
 std::pair<int, bool> bit_scan_reverse( uint32_t bitmask ){ return std::make_pair( -1, false ); }
 
+template< typename Tag_T = default_tag >
+std::pair<int, bool> bit_scan_reverse( uint64_t bitmask ){ return std::make_pair( -1, false ); }
+
+// Bit count
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup compare
+ * \brief Counts how many bits are set on the bitmask
+ *
+ * \param bitmask Bitmask to be counted
+ * \returns Number of bits set
+ *
+ * \see mask_to_lane_bitmask
+ */
+template< typename Tag_T = default_tag >
+inline int bit_count( uint32_t bitmask ){ return 0; }
+
+/**
+ * \ingroup compare
+ * \brief Counts how many bits are set on the 64 bits bitmask
+ *
+ * \param bitmask Bitmask to be counted
+ * \returns Number of bits set
+ *
+ * \see greater_node_bitmask
+ */
+template< typename Tag_T = default_tag >
+inline int bit_count( uint64_t bitmask ){ return 0; }
+
 /**
  * \ingroup compare
  * \brief Converts a SIMD mask to a bitmask
@@ -74,6 +103,50 @@ mask_to_bitmask( simd_type< ValueType_T, Tag_T > mask )
     return 0;
 }
 
+/**
+ * \ingroup compare
+ * \brief Converts a SIMD mask to a bitmask with one bit for each value
+ *
+ * Unlike mask_to_bitmask, the bitmask has exactly one bit for each value of the
+ * SIMD register, whatever the size of the value. The bit `i` is set when the
+ * value of index `i` is set on the mask.
+ *
+ * \param mask SIMD mask to be converted
+ * \tparam ValueType_T Base type of original SIMD register
+ * \returns Bitmask with one bit for each value
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/compare.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::simd_type< int32_t, ls::sse_tag > x( 9, 8, 7, 6 );
+ *     ls::simd_type< int32_t, ls::sse_tag > y( 9, 8, 5, 6 );
+ *     auto mask = ls::equal_to( x, y ); // (0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0xFFFFFFFF)
+ *     std::cout << "mask_to_lane_bitmask( mask ): " << std::hex
+ *               << ls::mask_to_lane_bitmask( mask ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * mask_to_lane_bitmask( mask ): d
+ * ```
+ *
+ * \see mask_to_bitmask, bit_count
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline typename simd_type< ValueType_T, Tag_T >::bitmask_type
+mask_to_lane_bitmask( simd_type< ValueType_T, Tag_T > mask )
+{
+    return 0;
+}
+
 /**
  * \ingroup compare
  * \brief Compares two SIMD registers and returns a mask representing the values of the first parameter is greater than the second parameter
@@ -0,0 +1,201 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ARCH_COMMON_MEMORY_H
+#define LITESIMD_ARCH_COMMON_MEMORY_H
+
+#include <litesimd/types.h>
+#include <litesimd/detail/arch/common/shuffle.h>
+
+namespace litesimd {
+
+// Load store
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup memory
+ * \brief Load a SIMD register from memory. The address does not need to be aligned.
+ *
+ * \param ptr Address of the first value to be loaded
+ * \tparam ValueType_T Base type of SIMD register
+ * \returns SIMD register with `simd_size` values starting at _ptr_
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/memory.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     int32_t array[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+ *     std::cout << "load( array + 1 ): "
+ *               << ls::load< int32_t, ls::sse_tag >( array + 1 ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * load( array + 1 ): (4, 3, 2, 1)
+ * ```
+ *
+ * \see store
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline simd_type< ValueType_T, Tag_T >
+load( const ValueType_T* ptr ){}
+
+/**
+ * \ingroup memory
+ * \brief Store a SIMD register to memory. The address does not need to be aligned.
+ *
+ * \param ptr Address where the first value will be stored
+ * \param vec SIMD register to be stored
+ * \tparam ValueType_T Base type of SIMD register
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/memory.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     int32_t array[ 5 ] = { 0 };
+ *     ls::store< int32_t, ls::sse_tag >( array + 1, ls::simd_type< int32_t, ls::sse_tag >( 4, 3, 2, 1 ) );
+ *     for( auto v : array )
+ *         std::cout << v << " ";
+ *     std::cout << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * 0 1 2 3 4
+ * ```
+ *
+ * \see load
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline void
+store( ValueType_T* ptr, simd_type< ValueType_T, Tag_T > vec ){}
+
+// Non-temporal store
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup memory
+ * \brief Store a SIMD register to memory bypassing the cache.
+ *
+ * The non-temporal store avoids reading the destination cache line and does not
+ * pollute the cache, which is faster when writing large buffers that will not be
+ * read soon. The address must be aligned to the SIMD register size and a
+ * stream_fence must be issued before other threads read the stored values.
+ *
+ * \param ptr Aligned address where the first value will be stored
+ * \param vec SIMD register to be stored
+ * \tparam ValueType_T Base type of SIMD register
+ *
+ * \see store, stream_fence
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline void
+stream( ValueType_T* ptr, simd_type< ValueType_T, Tag_T > vec ){}
+
+/**
+ * \ingroup memory
+ * \brief Orders all previous non-temporal stores before any following store.
+ *
+ * \see stream
+ */
+template< typename Tag_T = default_tag >
+inline void stream_fence(){}
+
+// Gather
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup memory
+ * \brief Loads each value of the SIMD register from a different index of an array.
+ *
+ * | Index | 3 | 2 | 1 | 0 |
+ * | :--- | :--: | :--: | :--: | :--: |
+ * | Register I | 7 | 0 | 2 | 5 |
+ * | litesimd::gather( ptr, I ) | ptr[7] | ptr[0] | ptr[2] | ptr[5] |
+ *
+ * The AVX version uses the gather instructions, the SSE version loads each value.
+ * Only 32 and 64 bits values are supported.
+ *
+ * \param ptr Address of the array
+ * \param idx Index of each value on the array
+ * \tparam ValueType_T Base type of SIMD register
+ * \returns SIMD register with the values loaded
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/memory.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     int32_t array[] = { 0, 10, 20, 30, 40, 50, 60, 70 };
+ *     ls::t_int32_simd idx( 7, 0, 2, 5 );
+ *     std::cout << "gather( array, idx ): "
+ *               << ls::gather< int32_t, ls::sse_tag >( array, idx ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * gather( array, idx ): (70, 0, 20, 50)
+ * ```
+ *
+ * \see load
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline simd_type< ValueType_T, Tag_T >
+gather( const ValueType_T* ptr, simd_type< typename permute_index< ValueType_T >::type, Tag_T > idx ){}
+
+// Prefetch
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup memory
+ * \brief Hints the processor to bring the cache line of the address to all cache levels.
+ *
+ * The prefetch does not fault on invalid addresses and does not change the program
+ * results. It is useful to start loading an address that will be read soon, while
+ * other independent work is done.
+ *
+ * \param ptr Address to prefetch
+ */
+template< typename Tag_T = default_tag >
+inline void prefetch( const void* ptr ){}
+
+} // namespace litesimd
+
+#endif // LITESIMD_ARCH_COMMON_MEMORY_H
@@ -23,6 +23,7 @@
 #ifndef LITESIMD_ARCH_COMMON_SHUFFLE_H
 #define LITESIMD_ARCH_COMMON_SHUFFLE_H
 
+#include <type_traits>
 #include <litesimd/types.h>
 
 namespace litesimd {
@@ -103,6 +104,151 @@ struct set_functor
     inline simd_type< ValueType_T, Tag_T > operator()( simd_type< ValueType_T, Tag_T >, ValueType_T ){}
 };
 
+// Reverse
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup shuffle
+ * \brief Reverses the order of the values inside the SIMD register.
+ *
+ * \param vec SIMD register
+ * \tparam ValueType_T Base type of original SIMD register
+ * \returns SIMD register with the value of index `i` on index `simd_size - 1 - i`
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/shuffle.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::simd_type< int32_t, ls::sse_tag > x( 3, 2, 1, 0 );
+ *     std::cout << "reverse( x ): " << ls::reverse( x ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * reverse( x ): (0, 1, 2, 3)
+ * ```
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline simd_type< ValueType_T, Tag_T >
+reverse( simd_type< ValueType_T, Tag_T > vec ){}
+
+// Permute
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup shuffle
+ * \brief Integer type of the indexes used by permute.
+ *
+ * It is an integer with the same size of _ValueType_T_, so the index register has
+ * one index for each value.
+ */
+template< typename ValueType_T >
+struct permute_index
+{
+    using type = typename std::conditional< sizeof( ValueType_T ) == 8, int64_t, int32_t >::type;
+};
+
+/**
+ * \ingroup shuffle
+ * \brief Moves the values inside the SIMD register to the indexes selected by other register.
+ *
+ * | Index | 3 | 2 | 1 | 0 |
+ * | :--- | :--: | :--: | :--: | :--: |
+ * | Register X | a | b | c | d |
+ * | Register I | 0 | 0 | 3 | 2 |
+ * | litesimd::permute( X, I ) | d | d | a | b |
+ *
+ * Only 32 and 64 bits values are supported. The indexes must be on the range
+ * [0, simd_size), the result of other values is undefined.
+ *
+ * \param vec SIMD register
+ * \param idx Index of the source value for each index of the result
+ * \tparam ValueType_T Base type of original SIMD register
+ * \returns SIMD register with the value `vec[ idx[ i ] ]` on index `i`
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/shuffle.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::simd_type< float, ls::sse_tag > x( 3.5f, 2.5f, 1.5f, 0.5f );
+ *     ls::simd_type< int32_t, ls::sse_tag > idx( 0, 0, 3, 2 );
+ *     std::cout << "permute( x, idx ): " << ls::permute( x, idx ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * permute( x, idx ): (0.5, 0.5, 3.5, 2.5)
+ * ```
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline simd_type< ValueType_T, Tag_T >
+permute( simd_type< ValueType_T, Tag_T > vec,
+         simd_type< typename permute_index< ValueType_T >::type, Tag_T > idx ){}
+
+// Compress
+// ---------------------------------------------------------------------------------------
+/**
+ * \ingroup shuffle
+ * \brief Moves the values selected by the mask to the lowest indexes of the SIMD register.
+ *
+ * The selected values are moved to the lowest indexes keeping their order and the
+ * other values are moved after them, also keeping their order. The number of
+ * selected values can be found with `bit_count( mask_to_lane_bitmask( mask ) )`.
+ *
+ * | Index | 3 | 2 | 1 | 0 |
+ * | :--- | :--: | :--: | :--: | :--: |
+ * | Register X | a | b | c | d |
+ * | Mask M | 0 | 1 | 0 | 1 |
+ * | litesimd::compress( M, X ) | a | c | b | d |
+ *
+ * Only 32 and 64 bits values are supported.
+ *
+ * \param mask SIMD mask selecting the values
+ * \param vec SIMD register
+ * \tparam ValueType_T Base type of original SIMD register
+ * \returns SIMD register with the selected values on the lowest indexes
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/compare.h>
+ * #include <litesimd/shuffle.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::simd_type< int32_t, ls::sse_tag > x( 4, 3, 2, 1 );
+ *     auto odd = ls::equal_to( ls::bit_and( x, 1 ), 1 ); // (0, 0xFFFFFFFF, 0, 0xFFFFFFFF)
+ *     std::cout << "compress( odd, x ): " << ls::compress( odd, x ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * compress( odd, x ): (4, 2, 3, 1)
+ * ```
+ */
+template< typename ValueType_T, typename Tag_T = default_tag >
+inline simd_type< ValueType_T, Tag_T >
+compress( simd_type< ValueType_T, Tag_T > mask, simd_type< ValueType_T, Tag_T > vec ){}
+
 } // namespace litesimd
 
 #endif // LITESIMD_ARCH_COMMON_SHUFFLE_H
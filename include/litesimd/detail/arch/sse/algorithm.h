@@ -73,6 +73,36 @@ max< int64_t, sse_tag >( simd_type< int64_t, sse_tag > lhs, simd_type< int64_t,
     return blend< int64_t, sse_tag >( mask, lhs, rhs );
 }
 
+// Widening sum
+// ---------------------------------------------------------------------------------------
+template<> inline simd_type< int64_t, sse_tag >
+widen_sum< int8_t, sse_tag >( simd_type< int8_t, sse_tag > vec )
+{
+    // sad against zero sums 8 unsigned bytes on each 64 bits lane, removes the bias after
+    __m128i bias = _mm_set1_epi8( static_cast< char >( 0x80 ) );
+    __m128i sum = _mm_sad_epu8( _mm_xor_si128( vec, bias ), _mm_setzero_si128() );
+    return _mm_sub_epi64( sum, _mm_set1_epi64x( 8 * 128 ) );
+}
+
+template<> inline simd_type< int64_t, sse_tag >
+widen_sum< int32_t, sse_tag >( simd_type< int32_t, sse_tag > vec )
+{
+    return _mm_add_epi64( _mm_cvtepi32_epi64( vec ),
+                          _mm_cvtepi32_epi64( _mm_srli_si128( vec, 8 ) ) );
+}
+
+template<> inline simd_type< int64_t, sse_tag >
+widen_sum< int16_t, sse_tag >( simd_type< int16_t, sse_tag > vec )
+{
+    return widen_sum< int32_t, sse_tag >( _mm_madd_epi16( vec, _mm_set1_epi16( 1 ) ) );
+}
+
+template<> inline simd_type< int64_t, sse_tag >
+widen_sum< int64_t, sse_tag >( simd_type< int64_t, sse_tag > vec )
+{
+    return vec;
+}
+
 } // namespace litesimd
 
 #endif // LITESIMD_HAS_SSE
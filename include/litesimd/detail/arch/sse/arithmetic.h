@@ -72,6 +72,8 @@ mullo< TYPE_T, sse_tag >( simd_type< TYPE_T, sse_tag > lhs, \
 
 DEF_MULLO( int16_t, _mm_mullo_epi16 )
 DEF_MULLO( int32_t, _mm_mullo_epi32 )
+DEF_MULLO( float,   _mm_mul_ps )
+DEF_MULLO( double,  _mm_mul_pd )
 #undef DEF_MULLO
 
 // MulHi
@@ -97,6 +99,17 @@ DEF_DIV( float,   _mm_div_ps )
 DEF_DIV( double,  _mm_div_pd )
 #undef DEF_DIV
 
+// Convert
+// ---------------------------------------------------------------------------------------
+#define DEF_CONVERT( TO_T, FROM_T, CMD ) \
+template<> inline simd_type< TO_T, sse_tag > \
+convert< TO_T, FROM_T, sse_tag >( simd_type< FROM_T, sse_tag > vec ) { \
+    return CMD( vec ); }
+
+DEF_CONVERT( float,   int32_t, _mm_cvtepi32_ps )
+DEF_CONVERT( int32_t, float,   _mm_cvttps_epi32 )
+#undef DEF_CONVERT
+
 } // namespace litesimd
 
 #endif // LITESIMD_HAS_SSE
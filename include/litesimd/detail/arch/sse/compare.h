@@ -25,6 +25,7 @@
 
 #ifdef LITESIMD_HAS_SSE
 
+#include <nmmintrin.h>
 #include <litesimd/types.h>
 #include <litesimd/detail/arch/common/compare.h>
 #include <litesimd/detail/helper_macros.h>
@@ -64,6 +65,45 @@ bit_scan_reverse< sse_tag >( uint32_t bitmask )
 #endif
 }
 
+template<> inline std::pair<int, bool>
+bit_scan_reverse< sse_tag >( uint64_t bitmask )
+{
+#if defined(_WIN64)
+    unsigned long index;
+    return (0 == _BitScanReverse64( &index, bitmask ))
+        ? std::make_pair( -1, false )
+        : std::make_pair( static_cast<int>( index ), true );
+#elif defined(__x86_64__)
+    return (bitmask == 0)
+        ? std::make_pair( -1, false )
+        : std::make_pair( 63 - __builtin_clzll( bitmask ), true );
+#else
+    auto bsr = bit_scan_reverse< sse_tag >( static_cast< uint32_t >( bitmask >> 32 ) );
+    return bsr.second
+        ? std::make_pair( bsr.first + 32, true )
+        : bit_scan_reverse< sse_tag >( static_cast< uint32_t >( bitmask ) );
+#endif
+}
+
+// Bit count
+// ---------------------------------------------------------------------------------------
+template<> inline int
+bit_count< sse_tag >( uint32_t bitmask )
+{
+    return _mm_popcnt_u32( bitmask );
+}
+
+template<> inline int
+bit_count< sse_tag >( uint64_t bitmask )
+{
+#if defined(_WIN64) || defined(__x86_64__)
+    return static_cast<int>( _mm_popcnt_u64( bitmask ) );
+#else
+    return _mm_popcnt_u32( static_cast< uint32_t >( bitmask ) ) +
+           _mm_popcnt_u32( static_cast< uint32_t >( bitmask >> 32 ) );
+#endif
+}
+
 // Mask to bitmask
 // ---------------------------------------------------------------------------------------
 #define DEF_MASK_TO_BITMASK( TYPE_T, CMD ) \
@@ -79,6 +119,44 @@ DEF_MASK_TO_BITMASK( float,   _mm_movemask_ps )
 DEF_MASK_TO_BITMASK( double,  _mm_movemask_pd )
 #undef DEF_MASK_TO_BITMASK
 
+// Mask to lane bitmask
+// ---------------------------------------------------------------------------------------
+template<> inline typename simd_type< int8_t, sse_tag >::bitmask_type
+mask_to_lane_bitmask< int8_t, sse_tag >( simd_type< int8_t, sse_tag > mask )
+{
+    return _mm_movemask_epi8( mask );
+}
+
+template<> inline typename simd_type< int16_t, sse_tag >::bitmask_type
+mask_to_lane_bitmask< int16_t, sse_tag >( simd_type< int16_t, sse_tag > mask )
+{
+    return _mm_movemask_epi8( _mm_packs_epi16( mask, _mm_setzero_si128() ) );
+}
+
+template<> inline typename simd_type< int32_t, sse_tag >::bitmask_type
+mask_to_lane_bitmask< int32_t, sse_tag >( simd_type< int32_t, sse_tag > mask )
+{
+    return _mm_movemask_ps( _mm_castsi128_ps( mask ) );
+}
+
+template<> inline typename simd_type< int64_t, sse_tag >::bitmask_type
+mask_to_lane_bitmask< int64_t, sse_tag >( simd_type< int64_t, sse_tag > mask )
+{
+    return _mm_movemask_pd( _mm_castsi128_pd( mask ) );
+}
+
+template<> inline typename simd_type< float, sse_tag >::bitmask_type
+mask_to_lane_bitmask< float, sse_tag >( simd_type< float, sse_tag > mask )
+{
+    return _mm_movemask_ps( mask );
+}
+
+template<> inline typename simd_type< double, sse_tag >::bitmask_type
+mask_to_lane_bitmask< double, sse_tag >( simd_type< double, sse_tag > mask )
+{
+    return _mm_movemask_pd( mask );
+}
+
 // Greater than
 // ---------------------------------------------------------------------------------------
 #define DEF_GREATER_THAN( TYPE_T, CMD ) \
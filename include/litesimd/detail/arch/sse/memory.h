@@ -0,0 +1,120 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_ARCH_SSE_MEMORY_H
+#define LITESIMD_ARCH_SSE_MEMORY_H
+
+#ifdef LITESIMD_HAS_SSE
+
+#include <smmintrin.h>
+#include <litesimd/types.h>
+#include <litesimd/detail/arch/common/memory.h>
+
+namespace litesimd {
+
+// Load
+// ---------------------------------------------------------------------------------------
+#define DEF_LOAD( TYPE_T, PTR_T, CMD ) \
+template<> inline simd_type< TYPE_T, sse_tag > \
+load< TYPE_T, sse_tag >( const TYPE_T* ptr ) { \
+    return CMD( reinterpret_cast< const PTR_T* >( ptr ) ); }
+
+DEF_LOAD( int8_t,  __m128i, _mm_loadu_si128 )
+DEF_LOAD( int16_t, __m128i, _mm_loadu_si128 )
+DEF_LOAD( int32_t, __m128i, _mm_loadu_si128 )
+DEF_LOAD( int64_t, __m128i, _mm_loadu_si128 )
+DEF_LOAD( float,   float,   _mm_loadu_ps )
+DEF_LOAD( double,  double,  _mm_loadu_pd )
+#undef DEF_LOAD
+
+// Store
+// ---------------------------------------------------------------------------------------
+#define DEF_STORE( TYPE_T, PTR_T, CMD ) \
+template<> inline void \
+store< TYPE_T, sse_tag >( TYPE_T* ptr, simd_type< TYPE_T, sse_tag > vec ) { \
+    CMD( reinterpret_cast< PTR_T* >( ptr ), vec ); }
+
+DEF_STORE( int8_t,  __m128i, _mm_storeu_si128 )
+DEF_STORE( int16_t, __m128i, _mm_storeu_si128 )
+DEF_STORE( int32_t, __m128i, _mm_storeu_si128 )
+DEF_STORE( int64_t, __m128i, _mm_storeu_si128 )
+DEF_STORE( float,   float,   _mm_storeu_ps )
+DEF_STORE( double,  double,  _mm_storeu_pd )
+#undef DEF_STORE
+
+// Non-temporal store
+// ---------------------------------------------------------------------------------------
+#define DEF_STREAM( TYPE_T, PTR_T, CMD ) \
+template<> inline void \
+stream< TYPE_T, sse_tag >( TYPE_T* ptr, simd_type< TYPE_T, sse_tag > vec ) { \
+    CMD( reinterpret_cast< PTR_T* >( ptr ), vec ); }
+
+DEF_STREAM( int8_t,  __m128i, _mm_stream_si128 )
+DEF_STREAM( int16_t, __m128i, _mm_stream_si128 )
+DEF_STREAM( int32_t, __m128i, _mm_stream_si128 )
+DEF_STREAM( int64_t, __m128i, _mm_stream_si128 )
+DEF_STREAM( float,   float,   _mm_stream_ps )
+DEF_STREAM( double,  double,  _mm_stream_pd )
+#undef DEF_STREAM
+
+// Gather
+// ---------------------------------------------------------------------------------------
+template<> inline simd_type< int32_t, sse_tag >
+gather< int32_t, sse_tag >( const int32_t* ptr, simd_type< int32_t, sse_tag > idx )
+{
+    return _mm_set_epi32( ptr[ _mm_extract_epi32( idx, 3 ) ], ptr[ _mm_extract_epi32( idx, 2 ) ],
+                          ptr[ _mm_extract_epi32( idx, 1 ) ], ptr[ _mm_cvtsi128_si32( idx ) ] );
+}
+
+template<> inline simd_type< int64_t, sse_tag >
+gather< int64_t, sse_tag >( const int64_t* ptr, simd_type< int64_t, sse_tag > idx )
+{
+    return _mm_set_epi64x( ptr[ _mm_extract_epi64( idx, 1 ) ], ptr[ _mm_cvtsi128_si64( idx ) ] );
+}
+
+template<> inline simd_type< float, sse_tag >
+gather< float, sse_tag >( const float* ptr, simd_type< int32_t, sse_tag > idx )
+{
+    return _mm_set_ps( ptr[ _mm_extract_epi32( idx, 3 ) ], ptr[ _mm_extract_epi32( idx, 2 ) ],
+                       ptr[ _mm_extract_epi32( idx, 1 ) ], ptr[ _mm_cvtsi128_si32( idx ) ] );
+}
+
+template<> inline simd_type< double, sse_tag >
+gather< double, sse_tag >( const double* ptr, simd_type< int64_t, sse_tag > idx )
+{
+    return _mm_set_pd( ptr[ _mm_extract_epi64( idx, 1 ) ], ptr[ _mm_cvtsi128_si64( idx ) ] );
+}
+
+template<> inline void stream_fence< sse_tag >()
+{
+    _mm_sfence();
+}
+
+template<> inline void prefetch< sse_tag >( const void* ptr )
+{
+    _mm_prefetch( static_cast< const char* >( ptr ), _MM_HINT_T0 );
+}
+
+} // namespace litesimd
+
+#endif // LITESIMD_HAS_SSE
+#endif // LITESIMD_ARCH_SSE_MEMORY_H
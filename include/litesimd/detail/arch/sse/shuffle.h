@@ -256,6 +256,164 @@ low_insert< double, sse_tag >( simd_type< double, sse_tag > vec,
     return set_functor<0, double, sse_tag>()( _mm_shuffle_pd( vec, vec, 0 ), val );
 }
 
+// Reverse
+// ---------------------------------------------------------------------------------------
+template<> inline simd_type< int8_t, sse_tag >
+reverse< int8_t, sse_tag >( simd_type< int8_t, sse_tag > vec )
+{
+    return _mm_shuffle_epi8( vec, _mm_setr_epi8( 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 ) );
+}
+
+template<> inline simd_type< int16_t, sse_tag >
+reverse< int16_t, sse_tag >( simd_type< int16_t, sse_tag > vec )
+{
+    return _mm_shuffle_epi8( vec, _mm_setr_epi8( 14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1 ) );
+}
+
+template<> inline simd_type< int32_t, sse_tag >
+reverse< int32_t, sse_tag >( simd_type< int32_t, sse_tag > vec )
+{
+    return _mm_shuffle_epi32( vec, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+}
+
+template<> inline simd_type< int64_t, sse_tag >
+reverse< int64_t, sse_tag >( simd_type< int64_t, sse_tag > vec )
+{
+    return _mm_shuffle_epi32( vec, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+}
+
+template<> inline simd_type< float, sse_tag >
+reverse< float, sse_tag >( simd_type< float, sse_tag > vec )
+{
+    return _mm_shuffle_ps( vec, vec, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+}
+
+template<> inline simd_type< double, sse_tag >
+reverse< double, sse_tag >( simd_type< double, sse_tag > vec )
+{
+    return _mm_shuffle_pd( vec, vec, 1 );
+}
+
+// Permute
+// ---------------------------------------------------------------------------------------
+namespace detail {
+
+// Converts the value indexes to a byte shuffle control
+inline __m128i permute_control_epi32( __m128i idx )
+{
+    __m128i bytes = _mm_shuffle_epi8( _mm_slli_epi32( idx, 2 ),
+                        _mm_setr_epi8( 0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12 ) );
+    return _mm_add_epi8( bytes, _mm_set1_epi32( 0x03020100 ) );
+}
+
+inline __m128i permute_control_epi64( __m128i idx )
+{
+    __m128i bytes = _mm_shuffle_epi8( _mm_slli_epi64( idx, 3 ),
+                        _mm_setr_epi8( 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8 ) );
+    return _mm_add_epi8( bytes, _mm_set1_epi64x( 0x0706050403020100LL ) );
+}
+
+} // namespace detail
+
+template<> inline simd_type< int32_t, sse_tag >
+permute< int32_t, sse_tag >( simd_type< int32_t, sse_tag > vec, simd_type< int32_t, sse_tag > idx )
+{
+    return _mm_shuffle_epi8( vec, detail::permute_control_epi32( idx ) );
+}
+
+template<> inline simd_type< int64_t, sse_tag >
+permute< int64_t, sse_tag >( simd_type< int64_t, sse_tag > vec, simd_type< int64_t, sse_tag > idx )
+{
+    return _mm_shuffle_epi8( vec, detail::permute_control_epi64( idx ) );
+}
+
+template<> inline simd_type< float, sse_tag >
+permute< float, sse_tag >( simd_type< float, sse_tag > vec, simd_type< int32_t, sse_tag > idx )
+{
+    return _mm_castsi128_ps( _mm_shuffle_epi8( _mm_castps_si128( vec ),
+                                               detail::permute_control_epi32( idx ) ) );
+}
+
+template<> inline simd_type< double, sse_tag >
+permute< double, sse_tag >( simd_type< double, sse_tag > vec, simd_type< int64_t, sse_tag > idx )
+{
+    return _mm_castsi128_pd( _mm_shuffle_epi8( _mm_castpd_si128( vec ),
+                                               detail::permute_control_epi64( idx ) ) );
+}
+
+// Compress
+// ---------------------------------------------------------------------------------------
+namespace detail {
+
+// Byte shuffle controls for each lane bitmask, selected values first
+inline const uint8_t* compress_control_epi32( int bitmask )
+{
+    static const uint8_t table[ 16 ][ 16 ] = {
+            { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+            { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+            { 4, 5, 6, 7, 0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15 },
+            { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+            { 8, 9, 10, 11, 0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15 },
+            { 0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15 },
+            { 4, 5, 6, 7, 8, 9, 10, 11, 0, 1, 2, 3, 12, 13, 14, 15 },
+            { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+            { 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 },
+            { 0, 1, 2, 3, 12, 13, 14, 15, 4, 5, 6, 7, 8, 9, 10, 11 },
+            { 4, 5, 6, 7, 12, 13, 14, 15, 0, 1, 2, 3, 8, 9, 10, 11 },
+            { 0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15, 8, 9, 10, 11 },
+            { 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7 },
+            { 0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15, 4, 5, 6, 7 },
+            { 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3 },
+            { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 }
+    };
+    return table[ bitmask ];
+}
+
+inline const uint8_t* compress_control_epi64( int bitmask )
+{
+    static const uint8_t table[ 4 ][ 16 ] = {
+            { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+            { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+            { 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7 },
+            { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 }
+    };
+    return table[ bitmask ];
+}
+
+} // namespace detail
+
+template<> inline simd_type< int32_t, sse_tag >
+compress< int32_t, sse_tag >( simd_type< int32_t, sse_tag > mask, simd_type< int32_t, sse_tag > vec )
+{
+    __m128i control = _mm_loadu_si128( reinterpret_cast< const __m128i* >(
+                            detail::compress_control_epi32( _mm_movemask_ps( _mm_castsi128_ps( mask ) ) ) ) );
+    return _mm_shuffle_epi8( vec, control );
+}
+
+template<> inline simd_type< int64_t, sse_tag >
+compress< int64_t, sse_tag >( simd_type< int64_t, sse_tag > mask, simd_type< int64_t, sse_tag > vec )
+{
+    __m128i control = _mm_loadu_si128( reinterpret_cast< const __m128i* >(
+                            detail::compress_control_epi64( _mm_movemask_pd( _mm_castsi128_pd( mask ) ) ) ) );
+    return _mm_shuffle_epi8( vec, control );
+}
+
+template<> inline simd_type< float, sse_tag >
+compress< float, sse_tag >( simd_type< float, sse_tag > mask, simd_type< float, sse_tag > vec )
+{
+    __m128i control = _mm_loadu_si128( reinterpret_cast< const __m128i* >(
+                            detail::compress_control_epi32( _mm_movemask_ps( mask ) ) ) );
+    return _mm_castsi128_ps( _mm_shuffle_epi8( _mm_castps_si128( vec ), control ) );
+}
+
+template<> inline simd_type< double, sse_tag >
+compress< double, sse_tag >( simd_type< double, sse_tag > mask, simd_type< double, sse_tag > vec )
+{
+    __m128i control = _mm_loadu_si128( reinterpret_cast< const __m128i* >(
+                            detail::compress_control_epi64( _mm_movemask_pd( mask ) ) ) );
+    return _mm_castsi128_pd( _mm_shuffle_epi8( _mm_castpd_si128( vec ), control ) );
+}
+
 } // namespace litesimd
 
 #endif // LITESIMD_HAS_SSE
@@ -0,0 +1,43 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LITESIMD_MEMORY_H
+#define LITESIMD_MEMORY_H
+
+#include <litesimd/types.h>
+#include <litesimd/detail/arch/memory.h>
+
+namespace litesimd {
+
+/**
+ * \defgroup memory Memory access
+ *
+ * In litesimd, the memory group has functions to move SIMD registers from and to
+ * memory. They are the building blocks of the algorithms which work on ranges of
+ * values instead of a single SIMD register.
+ *
+ * All this functions are accessable at `<litesimd/memory.h>`
+ */
+
+} // namespace litesimd
+
+#endif // LITESIMD_MEMORY_H
@@ -24,6 +24,7 @@
 #define LITESIMD_TYPES_H
 
 #include <cstdint>
+#include <cstring>
 #include <litesimd/detail/arch/traits.h>
 
 namespace litesimd {
@@ -163,6 +164,52 @@ using t_float_simd  = simd_type<  float, default_tag >;
 /// Shortcut for double simd_type on default instruction set
 using t_double_simd = simd_type< double, default_tag >;
 
+/**
+ * \ingroup type
+ * \brief Reinterprets the bits of a SIMD register as other base type.
+ *
+ * No value is converted, the returned register has exactly the same bits of
+ * the original one. This is useful to apply masks of one type on registers of
+ * another type with the same value size.
+ *
+ * \param vec SIMD register
+ * \tparam To_T Base type of returned SIMD register
+ * \returns The same bits as a `simd_type< To_T, Tag_T >`
+ *
+ * **Example**
+ * ```{.cpp}
+ * #include <iostream>
+ * #include <litesimd/types.h>
+ * #include <litesimd/helpers/iostream.h>
+ *
+ * int main()
+ * {
+ *     namespace ls = litesimd;
+ *
+ *     ls::simd_type< float, ls::sse_tag > x( 1.0f );
+ *     std::cout << std::hex << "reinterpret< int32_t >( x ): "
+ *               << ls::reinterpret< int32_t >( x ) << std::endl;
+ *     return 0;
+ * }
+ * ```
+ * Output on a SSE compilation
+ * ```
+ * reinterpret< int32_t >( x ): (3f800000, 3f800000, 3f800000, 3f800000)
+ * ```
+ */
+template< typename To_T, typename From_T, typename Tag_T >
+inline simd_type< To_T, Tag_T > reinterpret( simd_type< From_T, Tag_T > vec )
+{
+    using inner_type = typename simd_type< To_T, Tag_T >::inner_type;
+    static_assert( sizeof( inner_type ) == sizeof( typename simd_type< From_T, Tag_T >::inner_type ),
+                   "SIMD registers must have the same size" );
+
+    inner_type ret;
+    typename simd_type< From_T, Tag_T >::inner_type from = vec;
+    std::memcpy( &ret, &from, sizeof( ret ) );
+    return ret;
+}
+
 } // namespace litesimd
 
 #endif // LITESIMD_TYPES_H
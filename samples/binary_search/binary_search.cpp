@@ -31,7 +31,9 @@
 #include <litesimd/compare.h>
 #include <litesimd/shuffle.h>
 #include <litesimd/arithmetic.h>
+#include <litesimd/algorithm/binary_search.h>
 #include <litesimd/helpers/containers.h>
+#include <litesimd/container/eytzinger_array.h>
 
 bool g_verbose = true;
 namespace ls = litesimd;
@@ -320,6 +322,81 @@ private:
 };
 #endif // LITESIMD_HAS_AVX
 
+template< class Cont_T, typename TAG_T >
+struct container_ls_lb
+{
+	using container_type = Cont_T;
+    using value_type     = typename container_type::value_type;
+    using const_iterator = typename container_type::const_iterator;
+
+    container_ls_lb( const container_type& ref ) : ref_( ref ){}
+
+    void build_index(){}
+
+    const_iterator find( const value_type& key )
+    {
+        auto first = ls::lower_bound< TAG_T >( ref_.begin(), ref_.end(), key );
+        return (first!=ref_.end() && !(key<*first)) ? first : ref_.end();
+    }
+private:
+    const container_type& ref_;
+};
+
+template< class Cont_T, typename TAG_T >
+struct container_interpolation
+{
+	using container_type = Cont_T;
+    using value_type     = typename container_type::value_type;
+    using const_iterator = typename container_type::const_iterator;
+
+    container_interpolation( const container_type& ref ) : ref_( ref ){}
+
+    void build_index(){}
+
+    const_iterator find( const value_type& key )
+    {
+        auto first = ls::interpolation_lower_bound< TAG_T >( ref_.begin(), ref_.end(), key );
+        return (first!=ref_.end() && !(key<*first)) ? first : ref_.end();
+    }
+private:
+    const container_type& ref_;
+};
+
+// Copy of the keys on the Eytzinger layout, binary with NodeSize_T 1 or k-ary
+template< size_t NodeSize_T >
+struct eytzinger
+{
+    template< class Cont_T, typename TAG_T >
+    struct index
+    {
+        using container_type = Cont_T;
+        using value_type     = typename container_type::value_type;
+        using const_iterator = const value_type*;
+
+        index( const container_type& ref ) : ref_( ref ){}
+
+        void build_index()
+        {
+            array_ = ls::eytzinger_array< value_type, TAG_T, NodeSize_T >( ref_.begin(), ref_.end() );
+        }
+
+        const_iterator find( const value_type& key ) const
+        {
+            return array_.find( key );
+        }
+
+    private:
+        const container_type& ref_;
+        ls::eytzinger_array< value_type, TAG_T, NodeSize_T > array_;
+    };
+};
+
+template< class Cont_T, typename TAG_T >
+using eytzinger_binary = eytzinger< 1 >::index< Cont_T, TAG_T >;
+
+template< class Cont_T, typename TAG_T >
+using eytzinger_kary = eytzinger< 16 >::index< Cont_T, TAG_T >;
+
 void do_nothing( int32_t );
 
 template< class Cont_T, template < typename... > class Index_T, typename TAG_T >
@@ -396,11 +473,18 @@ int main(int argc, char* /*argv*/[])
         {
             uint64_t nocache =  bench< ls::vector< int32_t >, index_nocache, ls::sse_tag >( "index_nocache SSE ....", runSize, loop );
             uint64_t simdlb =  bench< ls::vector< int32_t >, container_simd_lb, ls::sse_tag >( "SIMD lower_bound SSE .", runSize, loop );
+            uint64_t lslb =  bench< ls::vector< int32_t >, container_ls_lb, ls::sse_tag >( "ls::lower_bound SSE ..", runSize, loop );
+            uint64_t interp = bench< ls::vector< int32_t >, container_interpolation, ls::sse_tag >( "interpolation SSE ....", runSize, loop );
+            uint64_t eytz =  bench< ls::vector< int32_t >, eytzinger_binary, ls::sse_tag >( "eytzinger binary .....", runSize, loop );
+            uint64_t kary =  bench< ls::vector< int32_t >, eytzinger_kary, ls::sse_tag >( "eytzinger 17-ary SSE .", runSize, loop );
 
 #ifdef LITESIMD_HAS_AVX
             uint64_t nocache2 = bench< ls::vector< int32_t >, index_nocache, ls::avx_tag >( "index_nocache AVX ....", runSize, loop );
             uint64_t simdlb2 = bench< ls::vector< int32_t >, container_simd_lb, ls::avx_tag >( "SIMD lower_bound AVX .", runSize, loop );
             uint64_t simdlb2v2 = bench< ls::vector< int32_t >, container_simd_lb2, ls::avx_tag >( "SIMD lower_boundv2 AVX", runSize, loop );
+            uint64_t lslb2 = bench< ls::vector< int32_t >, container_ls_lb, ls::avx_tag >( "ls::lower_bound AVX ..", runSize, loop );
+            uint64_t interp2 = bench< ls::vector< int32_t >, container_interpolation, ls::avx_tag >( "interpolation AVX ....", runSize, loop );
+            uint64_t kary2 = bench< ls::vector< int32_t >, eytzinger_kary, ls::avx_tag >( "eytzinger 17-ary AVX .", runSize, loop );
 #endif
 
             std::cout
@@ -413,6 +497,21 @@ int main(int argc, char* /*argv*/[])
                       << std::endl << "SIMD lower_bound Speed up SSE...: " << std::fixed << std::setprecision(2)
                       << static_cast<float>(base)/static_cast<float>(simdlb) << "x"
 
+                      << std::endl << "ls::lower_bound Speed up SSE....: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(base)/static_cast<float>(lslb) << "x"
+
+                      << std::endl << "Interpolation Speed up SSE......: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(base)/static_cast<float>(interp) << "x"
+
+                      << std::endl << "Interpolation/Index Cache SSE...: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(cache)/static_cast<float>(interp) << "x"
+
+                      << std::endl << "Eytzinger binary Speed up.......: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(base)/static_cast<float>(eytz) << "x"
+
+                      << std::endl << "Eytzinger 17-ary Speed up SSE...: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(base)/static_cast<float>(kary) << "x"
+
                       << std::endl << "Index Cache/Nocache Speed up SSE: " << std::fixed << std::setprecision(2)
                       << static_cast<float>(nocache)/static_cast<float>(cache) << "x"
 
@@ -428,6 +527,18 @@ int main(int argc, char* /*argv*/[])
 
                       << std::endl << "SIMD lower_boundv2 Speed up AVX.: " << std::fixed << std::setprecision(2)
                       << static_cast<float>(base)/static_cast<float>(simdlb2v2) << "x"
+
+                      << std::endl << "ls::lower_bound Speed up AVX....: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(base)/static_cast<float>(lslb2) << "x"
+
+                      << std::endl << "Interpolation Speed up AVX......: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(base)/static_cast<float>(interp2) << "x"
+
+                      << std::endl << "Interpolation/Index Cache AVX...: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(cache2)/static_cast<float>(interp2) << "x"
+
+                      << std::endl << "Eytzinger 17-ary Speed up AVX...: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(base)/static_cast<float>(kary2) << "x"
 #endif
 
                       << std::endl << std::endl;
@@ -0,0 +1,231 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include <set>
+#include <map>
+#include <boost/timer/timer.hpp>
+
+#include <litesimd/container/btree_set.h>
+
+bool g_verbose = true;
+namespace ls = litesimd;
+
+// Percent of finds and range scans on each workload, the other operations are half
+// inserts and half erases
+struct workload
+{
+    std::string name;
+    int find;
+    int scan;
+};
+
+enum class operation { find, scan, insert, erase };
+
+// Range scans count the keys in [key, key + scan_width)
+constexpr int32_t scan_width = 128;
+
+template< class Cont_T, typename TAG_T >
+struct std_set
+{
+    Cont_T cont;
+
+    template< typename Iterator_T >
+    void load( Iterator_T first, Iterator_T last ) { cont.insert( first, last ); }
+    void insert( int32_t key ) { cont.insert( key ); }
+    void erase( int32_t key ) { cont.erase( key ); }
+    bool find( int32_t key ) { return cont.find( key ) != cont.end(); }
+
+    int64_t scan( int32_t key )
+    {
+        int64_t count = 0;
+        for( auto it = cont.lower_bound( key ); it != cont.end() && *it < key + scan_width; ++it )
+            ++count;
+        return count;
+    }
+};
+
+template< class Cont_T, typename TAG_T >
+struct std_map
+{
+    Cont_T cont;
+
+    template< typename Iterator_T >
+    void load( Iterator_T first, Iterator_T last )
+    {
+        for( ; first != last; ++first )
+            cont[ *first ] = *first;
+    }
+    void insert( int32_t key ) { cont.insert( std::make_pair( key, key ) ); }
+    void erase( int32_t key ) { cont.erase( key ); }
+    bool find( int32_t key ) { return cont.find( key ) != cont.end(); }
+
+    int64_t scan( int32_t key )
+    {
+        int64_t count = 0;
+        for( auto it = cont.lower_bound( key ); it != cont.end() && it->first < key + scan_width; ++it )
+            ++count;
+        return count;
+    }
+};
+
+template< class Cont_T, typename TAG_T >
+struct btree_set
+{
+    ls::btree_set< int32_t, TAG_T > cont;
+
+    template< typename Iterator_T >
+    void load( Iterator_T first, Iterator_T last ) { cont = ls::btree_set< int32_t, TAG_T >( first, last ); }
+    void insert( int32_t key ) { cont.insert( key ); }
+    void erase( int32_t key ) { cont.erase( key ); }
+    bool find( int32_t key ) { return cont.contains( key ); }
+
+    // Counts the keys of whole registers with the range callback
+    int64_t scan( int32_t key )
+    {
+        int64_t count = 0;
+        cont.range( key, key + scan_width, [&count]( ls::simd_type< int32_t, TAG_T >, uint32_t bitmask ){
+            count += ls::bit_count< TAG_T >( bitmask );
+        });
+        return count;
+    }
+};
+
+void do_nothing( int64_t );
+
+template< class Cont_T, template< typename...> class Index_T, typename TAG_T >
+uint64_t bench( const std::string& name, const std::vector< int32_t >& initial,
+                const std::vector< std::pair< operation, int32_t > >& ops )
+{
+    using index_type = Index_T< Cont_T, TAG_T >;
+
+    boost::timer::cpu_timer timer;
+    index_type index;
+    index.load( initial.begin(), initial.end() );
+
+    int64_t found = 0;
+    timer.start();
+    for( auto&& op : ops )
+    {
+        switch( op.first )
+        {
+        case operation::find:   found += index.find( op.second ); break;
+        case operation::scan:   found += index.scan( op.second ); break;
+        case operation::insert: index.insert( op.second ); break;
+        case operation::erase:  index.erase( op.second ); break;
+        }
+    }
+    timer.stop();
+    do_nothing( found );
+    if( g_verbose )
+        std::cout << name << ": " << timer.format();
+
+    return timer.elapsed().wall;
+}
+
+int main(int argc, char* /*argv*/[])
+{
+    constexpr size_t runSize = 0x00100000;
+    constexpr size_t opSize = 0x00400000;
+    const std::vector< workload > workloads = {
+        { "read mostly", 90, 0 },
+        { "balanced ..", 50, 0 },
+        { "write heavy", 10, 0 },
+        { "range scan ", 40, 40 },
+    };
+
+    if( argc > 1 )
+    {
+        g_verbose = false;
+        std::cout << "Workload,std::set,std::map,SSE btree_set,AVX btree_set" << std::endl;
+    }
+    else
+    {
+        std::cout << "\nsize: 0x" << std::hex << std::setw(8) << std::setfill( '0') << runSize
+                  << ", operations: 0x" << std::setw(8) << opSize << std::endl << std::endl;
+    }
+
+    // Keys twice as spread as the initial set, so half of the finds miss and the
+    // inserts and erases keep the size around the initial one
+    srand( 1 );
+    std::vector< int32_t > initial;
+    std::generate_n( std::back_inserter( initial ), runSize, [](){ return rand() % (2 * runSize) ; } );
+
+    while( 1 )
+    {
+        for( auto&& work : workloads )
+        {
+            std::vector< std::pair< operation, int32_t > > ops;
+            for( size_t i = 0; i < opSize; ++i )
+            {
+                int32_t key = rand() % (2 * runSize);
+                int op = rand() % 100;
+                ops.push_back( std::make_pair( op < work.find ? operation::find
+                                             : op < work.find + work.scan ? operation::scan
+                                             : (op & 1) ? operation::insert : operation::erase, key ) );
+            }
+
+            if( g_verbose )
+                std::cout << work.name << std::endl;
+
+            uint64_t set = bench< std::set< int32_t >, std_set, void >( "std::set ........", initial, ops );
+            uint64_t map = bench< std::map< int32_t, int32_t >, std_map, void >( "std::map ........", initial, ops );
+            uint64_t sse = bench< void, btree_set, ls::sse_tag >( "SSE btree_set ...", initial, ops );
+#ifdef LITESIMD_HAS_AVX
+            uint64_t avx = bench< void, btree_set, ls::avx_tag >( "AVX btree_set ...", initial, ops );
+#endif
+
+            if( g_verbose )
+            {
+                std::cout
+                    << std::endl << "SSE btree_set/std::set: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(set)/static_cast<float>(sse) << "x"
+                    << std::endl << "SSE btree_set/std::map: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(map)/static_cast<float>(sse) << "x"
+#ifdef LITESIMD_HAS_AVX
+                    << std::endl << "AVX btree_set/std::set: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(set)/static_cast<float>(avx) << "x"
+                    << std::endl << "AVX btree_set/std::map: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(map)/static_cast<float>(avx) << "x"
+#endif
+                    << std::endl << std::endl;
+            }
+            else
+            {
+                std::cout
+                    << work.name
+                    << "," << set
+                    << "," << map
+                    << "," << sse
+#ifdef LITESIMD_HAS_AVX
+                    << "," << avx
+#endif
+                    << std::endl;
+            }
+        }
+    }
+    return 0;
+}
@@ -28,6 +28,7 @@
 
 #include <litesimd/compare.h>
 #include <litesimd/shuffle.h>
+#include <litesimd/algorithm/sort.h>
 #include <litesimd/helpers/containers.h>
 
 bool g_verbose = true;
@@ -132,6 +133,17 @@ struct stl_sort
     }
 };
 
+template< class Cont_T, typename TAG_T >
+struct ls_sort
+{
+	using container_type = Cont_T;
+
+    void sort( container_type& cont )
+    {
+        ls::sort< TAG_T >( cont.data(), cont.data() + cont.size() );
+    }
+};
+
 template< class Cont_T, typename TAG_T >
 struct basic_bubble_sort
 {
@@ -231,7 +243,13 @@ int main(int argc, char* /*argv*/[])
 
         if( g_verbose )
         {
-            bench< ls::vector< int32_t >, stl_sort, void >( "STL sort ........", runSize, loop );
+            uint64_t stlsort = bench< ls::vector< int32_t >, stl_sort, void >( "STL sort ........", runSize, loop );
+            uint64_t ssequick = bench< ls::vector< int32_t >, ls_sort,
+                                     ls::sse_tag >( "SSE ls::sort ....", runSize, loop );
+#ifdef LITESIMD_HAS_AVX
+            uint64_t avxquick = bench< ls::vector< int32_t >, ls_sort,
+                                     ls::avx_tag >( "AVX ls::sort ....", runSize, loop );
+#endif
 
             std::cout
                 << std::endl << "SSE Speed up ......: " << std::fixed << std::setprecision(2)
@@ -249,6 +267,12 @@ int main(int argc, char* /*argv*/[])
                 << std::endl << "AVX2/AVX Speed up .: " << std::fixed << std::setprecision(2)
                 << static_cast<float>(avxsort)/static_cast<float>(avxsort2) << "x"
 #endif
+                << std::endl << "SSE ls::sort/STL ..: " << std::fixed << std::setprecision(2)
+                << static_cast<float>(stlsort)/static_cast<float>(ssequick) << "x"
+#ifdef LITESIMD_HAS_AVX
+                << std::endl << "AVX ls::sort/STL ..: " << std::fixed << std::setprecision(2)
+                << static_cast<float>(stlsort)/static_cast<float>(avxquick) << "x"
+#endif
 
                 << std::endl << std::endl;
         }
@@ -0,0 +1,177 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+#include <boost/timer/timer.hpp>
+
+#include <litesimd/container/concurrent_hash_map.h>
+
+bool g_verbose = true;
+namespace ls = litesimd;
+
+template< typename TAG_T >
+struct locked_map
+{
+    std::unordered_map< int64_t, int64_t > cont;
+    std::mutex mutex;
+
+    void insert_or_assign( int64_t key, int64_t value )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        cont[ key ] = value;
+    }
+
+    bool find( int64_t key, int64_t& value )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        auto it = cont.find( key );
+        if( it == cont.end() )
+            return false;
+        value = it->second;
+        return true;
+    }
+};
+
+template< typename TAG_T >
+struct concurrent_map
+{
+    ls::concurrent_hash_map< int64_t, int64_t, std::hash< int64_t >, std::equal_to< int64_t >, TAG_T > cont;
+
+    void insert_or_assign( int64_t key, int64_t value ) { cont.insert_or_assign( key, value ); }
+    bool find( int64_t key, int64_t& value ) { return cont.find( key, value ); }
+};
+
+void do_nothing( int64_t );
+
+// Each reader thread searches its share of the lookups, while one writer thread changes
+// a key each 100us, as on a slowly changing session table
+template< template< typename > class Map_T, typename TAG_T >
+uint64_t bench( const std::string& name, const std::vector< int64_t >& keys,
+                size_t lookups, size_t threads )
+{
+    Map_T< TAG_T > map;
+    for( int64_t key : keys )
+        map.insert_or_assign( key, key );
+
+    std::atomic< bool > done( false );
+    std::thread writer( [&]()
+    {
+        std::mt19937_64 gen( 2 );
+        while( !done.load( std::memory_order_relaxed ) )
+        {
+            int64_t key = keys[ gen() % keys.size() ];
+            map.insert_or_assign( key, key + 1 );
+            std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+        }
+    } );
+
+    boost::timer::cpu_timer timer;
+    std::vector< std::thread > readers;
+    for( size_t t = 0; t < threads; ++t )
+    {
+        readers.emplace_back( [&, t]()
+        {
+            std::mt19937_64 gen( t );
+            int64_t sum = 0;
+            int64_t value;
+            for( size_t i = 0; i < lookups / threads; ++i )
+                sum += map.find( keys[ gen() % keys.size() ], value ) ? value : 0;
+            do_nothing( sum );
+        } );
+    }
+    for( auto& reader : readers )
+        reader.join();
+    timer.stop();
+
+    done.store( true );
+    writer.join();
+
+    if( g_verbose )
+        std::cout << name << threads << " threads: " << timer.format();
+    return timer.elapsed().wall;
+}
+
+int main(int argc, char* /*argv*/[])
+{
+    constexpr size_t runSize = 0x00100000;
+    constexpr size_t lookups = 0x01000000;
+
+    if( argc > 1 )
+    {
+        g_verbose = false;
+        std::cout << "Threads,std::mutex+std::unordered_map,SSE concurrent_hash_map,AVX concurrent_hash_map" << std::endl;
+    }
+    else
+    {
+        std::cout << "\nsize: 0x" << std::hex << std::setw(8) << std::setfill( '0') << runSize
+                  << ", lookups: 0x" << std::setw(8) << lookups << std::dec << std::endl << std::endl;
+    }
+
+    std::mt19937_64 gen( 1 );
+    std::vector< int64_t > keys( runSize );
+    std::generate( keys.begin(), keys.end(), [&](){ return static_cast< int64_t >( gen() >> 1 ); } );
+
+    size_t cores = std::max< size_t >( 1, std::thread::hardware_concurrency() );
+    while( 1 )
+    {
+        for( size_t threads = 1; threads <= 2 * cores; threads *= 2 )
+        {
+            uint64_t locked = bench< locked_map, void >( "std::mutex+std::unordered_map, ", keys, lookups, threads );
+            uint64_t sse = bench< concurrent_map, ls::sse_tag >( "SSE concurrent_hash_map, ", keys, lookups, threads );
+#ifdef LITESIMD_HAS_AVX
+            uint64_t avx = bench< concurrent_map, ls::avx_tag >( "AVX concurrent_hash_map, ", keys, lookups, threads );
+#endif
+
+            if( g_verbose )
+            {
+                std::cout
+                    << std::endl << "SSE concurrent_hash_map/locked std::unordered_map: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(locked)/static_cast<float>(sse) << "x"
+#ifdef LITESIMD_HAS_AVX
+                    << std::endl << "AVX concurrent_hash_map/locked std::unordered_map: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(locked)/static_cast<float>(avx) << "x"
+#endif
+                    << std::endl << std::endl;
+            }
+            else
+            {
+                std::cout
+                    << threads
+                    << "," << locked
+                    << "," << sse
+#ifdef LITESIMD_HAS_AVX
+                    << "," << avx
+#endif
+                    << std::endl;
+            }
+        }
+    }
+    return 0;
+}
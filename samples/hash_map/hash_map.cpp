@@ -0,0 +1,234 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <unordered_map>
+#include <boost/timer/timer.hpp>
+
+#include <litesimd/container/flat_hash_map.h>
+
+bool g_verbose = true;
+namespace ls = litesimd;
+
+// Times of each operation on all keys
+struct result
+{
+    uint64_t insert;
+    uint64_t hit;
+    uint64_t miss;
+    uint64_t erase;
+};
+
+template< class Cont_T, typename TAG_T >
+struct std_map
+{
+    Cont_T cont;
+
+    void insert( int64_t key ) { cont.insert( std::make_pair( key, key ) ); }
+    void erase( int64_t key ) { cont.erase( key ); }
+    int64_t find( int64_t key )
+    {
+        auto it = cont.find( key );
+        return it == cont.end() ? 0 : it->second;
+    }
+    int64_t find_all( const std::vector< int64_t >& keys )
+    {
+        int64_t sum = 0;
+        for( int64_t key : keys )
+            sum += find( key );
+        return sum;
+    }
+};
+
+template< class Cont_T, typename TAG_T >
+struct flat_map
+{
+    ls::flat_hash_map< int64_t, int64_t, std::hash< int64_t >, std::equal_to< int64_t >, TAG_T > cont;
+
+    void insert( int64_t key ) { cont.insert( std::make_pair( key, key ) ); }
+    void erase( int64_t key ) { cont.erase( key ); }
+    int64_t find( int64_t key )
+    {
+        auto it = cont.find( key );
+        return it == cont.end() ? 0 : it->second;
+    }
+    int64_t find_all( const std::vector< int64_t >& keys )
+    {
+        int64_t sum = 0;
+        for( int64_t key : keys )
+            sum += find( key );
+        return sum;
+    }
+};
+
+// Same table searched with find_many on batches of keys
+template< class Cont_T, typename TAG_T >
+struct flat_map_batch : flat_map< Cont_T, TAG_T >
+{
+    using const_iterator = typename decltype( flat_map< Cont_T, TAG_T >::cont )::const_iterator;
+
+    int64_t find_all( const std::vector< int64_t >& keys )
+    {
+        constexpr size_t batch = 256;
+        const_iterator found[ batch ];
+        int64_t sum = 0;
+        for( size_t i = 0; i < keys.size(); i += batch )
+        {
+            size_t count = std::min( batch, keys.size() - i );
+            this->cont.find_many( keys.begin() + i, keys.begin() + i + count, found );
+            for( size_t j = 0; j < count; ++j )
+                sum += found[ j ] == this->cont.end() ? 0 : found[ j ]->second;
+        }
+        return sum;
+    }
+};
+
+void do_nothing( int64_t );
+
+template< class Cont_T, template< typename...> class Index_T, typename TAG_T >
+result bench( const std::string& name, const std::vector< int64_t >& keys,
+              const std::vector< int64_t >& hits, const std::vector< int64_t >& misses, size_t rounds )
+{
+    boost::timer::cpu_timer timer;
+    result ret = {};
+
+    // Small tables run many rounds, for the same number of operations of the large ones
+    for( size_t r = 0; r < rounds; ++r )
+    {
+        Index_T< Cont_T, TAG_T > index;
+
+        timer.start();
+        for( int64_t key : keys )
+            index.insert( key );
+        timer.stop();
+        ret.insert += timer.elapsed().wall;
+
+        timer.start();
+        do_nothing( index.find_all( hits ) );
+        timer.stop();
+        ret.hit += timer.elapsed().wall;
+
+        timer.start();
+        do_nothing( index.find_all( misses ) );
+        timer.stop();
+        ret.miss += timer.elapsed().wall;
+
+        timer.start();
+        for( size_t i = 0; i < keys.size(); i += 2 )
+            index.erase( keys[ i ] );
+        timer.stop();
+        ret.erase += timer.elapsed().wall;
+    }
+
+    if( g_verbose )
+    {
+        std::cout << name << ": insert " << std::fixed << std::setprecision(3) << ret.insert / 1e9
+                  << "s, find hit " << ret.hit / 1e9
+                  << "s, find miss " << ret.miss / 1e9
+                  << "s, erase " << ret.erase / 1e9 << "s" << std::endl;
+    }
+    return ret;
+}
+
+void speedup( const std::string& name, const result& base, const result& res )
+{
+    std::cout << name << std::fixed << std::setprecision(2)
+              << ": insert " << static_cast<float>(base.insert)/static_cast<float>(res.insert) << "x"
+              << ", find hit " << static_cast<float>(base.hit)/static_cast<float>(res.hit) << "x"
+              << ", find miss " << static_cast<float>(base.miss)/static_cast<float>(res.miss) << "x"
+              << ", erase " << static_cast<float>(base.erase)/static_cast<float>(res.erase) << "x"
+              << std::endl;
+}
+
+void csv( size_t size, const std::string& name, const result& res )
+{
+    std::cout << size << "," << name << "," << res.insert << "," << res.hit
+              << "," << res.miss << "," << res.erase << std::endl;
+}
+
+int main(int argc, char* /*argv*/[])
+{
+    if( argc > 1 )
+    {
+        g_verbose = false;
+        std::cout << "Size,Container,Insert,Find hit,Find miss,Erase" << std::endl;
+    }
+
+    constexpr size_t smallSize = 0x00010000;
+    constexpr size_t opSize = 0x00800000;
+    std::mt19937_64 gen( 1 );
+    while( 1 )
+    {
+        // A table inside the cache and a table larger than the cache
+        for( size_t size : { smallSize, opSize } )
+        {
+            std::vector< int64_t > keys( size );
+            std::vector< int64_t > misses( size );
+            for( size_t i = 0; i < size; ++i )
+            {
+                // Even keys are inserted, odd keys miss
+                keys[ i ] = static_cast< int64_t >( gen() & ~UINT64_C( 1 ) );
+                misses[ i ] = keys[ i ] | 1;
+            }
+            std::vector< int64_t > hits( keys );
+            std::shuffle( hits.begin(), hits.end(), gen );
+
+            if( g_verbose )
+                std::cout << "\nsize: 0x" << std::hex << std::setw(8) << std::setfill( '0') << size
+                          << ", operations: 0x" << std::setw(8) << opSize << std::dec << std::endl;
+
+            result std = bench< std::unordered_map< int64_t, int64_t >, std_map, void >( "std::unordered_map ....", keys, hits, misses, opSize / size );
+            result sse = bench< void, flat_map, ls::sse_tag >( "SSE flat_hash_map .....", keys, hits, misses, opSize / size );
+            result sse_batch = bench< void, flat_map_batch, ls::sse_tag >( "SSE find_many .........", keys, hits, misses, opSize / size );
+#ifdef LITESIMD_HAS_AVX
+            result avx = bench< void, flat_map, ls::avx_tag >( "AVX flat_hash_map .....", keys, hits, misses, opSize / size );
+            result avx_batch = bench< void, flat_map_batch, ls::avx_tag >( "AVX find_many .........", keys, hits, misses, opSize / size );
+#endif
+
+            if( g_verbose )
+            {
+                std::cout << std::endl;
+                speedup( "SSE flat_hash_map/std::unordered_map", std, sse );
+                speedup( "SSE find_many/std::unordered_map....", std, sse_batch );
+#ifdef LITESIMD_HAS_AVX
+                speedup( "AVX flat_hash_map/std::unordered_map", std, avx );
+                speedup( "AVX find_many/std::unordered_map....", std, avx_batch );
+#endif
+            }
+            else
+            {
+                csv( size, "std::unordered_map", std );
+                csv( size, "SSE flat_hash_map", sse );
+                csv( size, "SSE find_many", sse_batch );
+#ifdef LITESIMD_HAS_AVX
+                csv( size, "AVX flat_hash_map", avx );
+                csv( size, "AVX find_many", avx_batch );
+#endif
+            }
+        }
+    }
+    return 0;
+}
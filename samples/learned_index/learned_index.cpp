@@ -0,0 +1,170 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <boost/timer/timer.hpp>
+
+#include <litesimd/container/static_search_tree.h>
+#include <litesimd/container/learned_index.h>
+
+bool g_verbose = true;
+namespace ls = litesimd;
+
+template< typename TAG_T >
+struct std_lower_bound
+{
+    std::vector< int64_t > cont;
+
+    template< typename Iterator_T >
+    void load( Iterator_T first, Iterator_T last ) { cont.assign( first, last ); }
+    int64_t find( int64_t key ) { return std::lower_bound( cont.begin(), cont.end(), key ) - cont.begin(); }
+};
+
+template< typename TAG_T >
+struct search_tree
+{
+    ls::static_search_tree< int64_t, TAG_T > cont;
+
+    template< typename Iterator_T >
+    void load( Iterator_T first, Iterator_T last ) { cont = ls::static_search_tree< int64_t, TAG_T >( first, last ); }
+    int64_t find( int64_t key ) { return cont.lower_bound( key ) - cont.begin(); }
+};
+
+template< typename TAG_T >
+struct learned_index
+{
+    ls::learned_index< int64_t, TAG_T > cont;
+
+    template< typename Iterator_T >
+    void load( Iterator_T first, Iterator_T last ) { cont = ls::learned_index< int64_t, TAG_T >( first, last ); }
+    int64_t find( int64_t key ) { return cont.lower_bound( key ) - cont.begin(); }
+};
+
+void do_nothing( int64_t );
+
+template< template< typename > class Index_T, typename TAG_T >
+uint64_t bench( const std::string& name, const std::vector< int64_t >& keys,
+                const std::vector< int64_t >& search )
+{
+    boost::timer::cpu_timer timer;
+    Index_T< TAG_T > index;
+    index.load( keys.begin(), keys.end() );
+
+    int64_t sum = 0;
+    timer.start();
+    for( int64_t key : search )
+        sum += index.find( key );
+    timer.stop();
+    do_nothing( sum );
+    if( g_verbose )
+        std::cout << name << ": " << timer.format();
+
+    return timer.elapsed().wall;
+}
+
+int main(int argc, char* /*argv*/[])
+{
+    constexpr size_t runSize = 0x01000000;
+    constexpr size_t searchSize = 0x00400000;
+
+    if( argc > 1 )
+    {
+        g_verbose = false;
+        std::cout << "Keys,std::lower_bound,SSE tree,SSE learned,AVX tree,AVX learned" << std::endl;
+    }
+    else
+    {
+        std::cout << "\nsize: 0x" << std::hex << std::setw(8) << std::setfill( '0') << runSize
+                  << ", searches: 0x" << std::setw(8) << searchSize << std::dec << std::endl << std::endl;
+    }
+
+    std::mt19937_64 gen( 1 );
+    while( 1 )
+    {
+        // Random keys on the whole range, where each segment of the model covers a few
+        // hundred keys, and timestamp like keys, one each 10 seconds with some jitter,
+        // where a handful of segments cover all keys
+        for( bool smooth : { false, true } )
+        {
+            std::vector< int64_t > keys( runSize );
+            for( size_t i = 0; i < runSize; ++i )
+                keys[ i ] = smooth ? static_cast< int64_t >( 1500000000 + i * 10 + gen() % 8 )
+                                   : static_cast< int64_t >( gen() >> 1 );
+            std::sort( keys.begin(), keys.end() );
+
+            std::vector< int64_t > search( searchSize );
+            std::uniform_int_distribution< int64_t > dist( keys.front(), keys.back() );
+            std::generate( search.begin(), search.end(), [&](){ return dist( gen ); } );
+
+            const char* name = smooth ? "smooth" : "random";
+            if( g_verbose )
+            {
+                ls::learned_index< int64_t > model( keys.begin(), keys.end() );
+                std::cout << name << " keys, " << model.segments() << " segments, index "
+                          << model.index_bytes() / 1024 << " KB for "
+                          << runSize * sizeof( int64_t ) / 1024 << " KB of keys" << std::endl;
+            }
+
+            uint64_t stl = bench< std_lower_bound, void >( "std::lower_bound ..", keys, search );
+            uint64_t sse_tree = bench< search_tree, ls::sse_tag >( "SSE search tree ...", keys, search );
+            uint64_t sse_learned = bench< learned_index, ls::sse_tag >( "SSE learned index .", keys, search );
+#ifdef LITESIMD_HAS_AVX
+            uint64_t avx_tree = bench< search_tree, ls::avx_tag >( "AVX search tree ...", keys, search );
+            uint64_t avx_learned = bench< learned_index, ls::avx_tag >( "AVX learned index .", keys, search );
+#endif
+
+            if( g_verbose )
+            {
+                std::cout
+                    << std::endl << "SSE search tree/std::lower_bound: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(stl)/static_cast<float>(sse_tree) << "x"
+                    << std::endl << "SSE learned index/std::lower_bound: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(stl)/static_cast<float>(sse_learned) << "x"
+#ifdef LITESIMD_HAS_AVX
+                    << std::endl << "AVX search tree/std::lower_bound: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(stl)/static_cast<float>(avx_tree) << "x"
+                    << std::endl << "AVX learned index/std::lower_bound: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(stl)/static_cast<float>(avx_learned) << "x"
+#endif
+                    << std::endl << std::endl;
+            }
+            else
+            {
+                std::cout
+                    << name
+                    << "," << stl
+                    << "," << sse_tree
+                    << "," << sse_learned
+#ifdef LITESIMD_HAS_AVX
+                    << "," << avx_tree
+                    << "," << avx_learned
+#endif
+                    << std::endl;
+            }
+        }
+    }
+    return 0;
+}
@@ -24,12 +24,15 @@
 #include <iomanip>
 #include <algorithm>
 #include <numeric>
+#include <limits>
 #include <map>
 #include <boost/timer/timer.hpp>
 
 #include <litesimd/types.h>
 #include <litesimd/compare.h>
 #include <litesimd/helpers/containers.h>
+#include <litesimd/container/static_search_tree.h>
+#include <litesimd/container/compressed_search_tree.h>
 
 bool g_verbose = true;
 namespace ls = litesimd;
@@ -100,36 +103,39 @@ public:
 
     const_iterator find( const value_type& key ) const
     {
+        simd_type key_vec( key );
         size_t idx = 0;
         for( auto&& level : tree_ )
         {
-            int li = ls::greater_last_index< value_type, TAG_T >( key, *level.get_simd( idx ) );
-            idx = idx * array_size + li + 1;
+            // The node is sorted, so the count of keys less than key is the child index
+            idx = idx * array_size + ls::bit_count< TAG_T >(
+                        ls::greater_node_bitmask< array_size >( key_vec, level.get_node( idx ) ) );
         }
 
-        const simd_type* cmp = reinterpret_cast< const simd_type* >( &ref_[ idx * array_size ] );
-        int off = ls::equal_to_last_index< value_type, TAG_T >( key, *cmp );
+        size_t off = idx * array_size + ls::bit_count< TAG_T >(
+                        ls::greater_node_bitmask< array_size >( key_vec, &ref_[ idx * array_size ] ) );
 
-        if( off < 0 )
+        if( off >= ref_.size() || ref_[ off ] != key )
         {
             return ref_.end();
         }
         auto it = ref_.begin();
-        std::advance( it, idx * array_size + off );
+        std::advance( it, off );
         return it;
     }
 
 private:
-    constexpr static size_t array_size = ls::simd_type< value_type, TAG_T >::simd_size;
+    // One cache line of keys on each node, compared by several registers at once
+    constexpr static size_t array_size = 64 / sizeof( value_type );
     using simd_type = ls::simd_type< value_type, TAG_T >;
 
     struct tree_level
     {
         ls::vector< value_type > keys_;
 
-        const simd_type* get_simd( size_t idx ) const
+        const value_type* get_node( size_t idx ) const
         {
-            return reinterpret_cast< const simd_type* >( &keys_[ idx * array_size ] );
+            return &keys_[ idx * array_size ];
         }
 
         void adjust()
@@ -164,6 +170,58 @@ private:
     }
 };
 
+template< class Cont_T, typename TAG_T >
+class search_tree
+{
+public:
+	using container_type = Cont_T;
+    using value_type     = typename container_type::value_type;
+    using tree_type      = ls::static_search_tree< value_type, TAG_T >;
+    using const_iterator = typename tree_type::const_iterator;
+
+    search_tree( const container_type& ref ) : ref_( ref ){}
+
+    void build_index()
+    {
+        tree_ = tree_type( ref_.begin(), ref_.end() );
+    }
+
+    const_iterator find( const value_type& key ) const
+    {
+        return tree_.find( key );
+    }
+
+private:
+    const container_type& ref_;
+    tree_type tree_;
+};
+
+template< class Cont_T, typename TAG_T >
+class compressed_tree
+{
+public:
+	using container_type = Cont_T;
+    using value_type     = typename container_type::value_type;
+    using tree_type      = ls::compressed_search_tree< value_type, TAG_T >;
+    using const_iterator = typename tree_type::const_iterator;
+
+    compressed_tree( const container_type& ref ) : ref_( ref ){}
+
+    void build_index()
+    {
+        tree_ = tree_type( ref_.begin(), ref_.end() );
+    }
+
+    const_iterator find( const value_type& key ) const
+    {
+        return tree_.find( key );
+    }
+
+private:
+    const container_type& ref_;
+    tree_type tree_;
+};
+
 void do_nothing( int32_t );
 
 template< class Cont_T, template < typename... > class Index_T, typename TAG_T >
@@ -199,52 +257,97 @@ uint64_t bench( const std::string& name, size_t size, size_t loop )
     return timer.elapsed().wall;
 }
 
-int main(int argc, char* /*argv*/[])
+void run( size_t runSize )
 {
-    constexpr size_t runSize = 0x00400000;
-    constexpr size_t loop = 10;
-    if( argc > 1 )
-    {
-        g_verbose = false;
-        std::cout << "base,index_sse,index_avx" << std::endl;
-    }
-    else
+    // Same number of searches on all sizes
+    const size_t loop = std::max< size_t >( 1, 0x02800000 / runSize );
+    if( g_verbose )
     {
-        std::cout << "\nsize: 0x" << std::hex << std::setw(8) << std::setfill( '0') << runSize << std::endl << std::endl;
+        std::cout << "\nsize: 0x" << std::hex << std::setw(8) << std::setfill( '0') << runSize
+                  << std::dec << std::endl << std::endl;
     }
-    while( 1 )
-    {
-        uint64_t base = bench< ls::vector< int32_t >, container_only, void >( "lower_bound .", runSize, loop );
-        uint64_t index1 = bench< ls::vector< int32_t >, nway_tree, ls::sse_tag >( "index SSE ...", runSize, loop );
+
+    uint64_t base = bench< ls::vector< int32_t >, container_only, void >( "lower_bound .", runSize, loop );
+    uint64_t index1 = bench< ls::vector< int32_t >, nway_tree, ls::sse_tag >( "index SSE ...", runSize, loop );
 #ifdef LITESIMD_HAS_AVX
-        uint64_t index2 = bench< ls::vector< int32_t >, nway_tree, ls::avx_tag >( "index AVX ...", runSize, loop );
+    uint64_t index2 = bench< ls::vector< int32_t >, nway_tree, ls::avx_tag >( "index AVX ...", runSize, loop );
+#endif // LITESIMD_HAS_AVX
+    uint64_t tree1 = bench< ls::vector< int32_t >, search_tree, ls::sse_tag >( "tree SSE ....", runSize, loop );
+#ifdef LITESIMD_HAS_AVX
+    uint64_t tree2 = bench< ls::vector< int32_t >, search_tree, ls::avx_tag >( "tree AVX ....", runSize, loop );
+#endif // LITESIMD_HAS_AVX
+    uint64_t ctree1 = bench< ls::vector< int32_t >, compressed_tree, ls::sse_tag >( "ctree SSE ...", runSize, loop );
+#ifdef LITESIMD_HAS_AVX
+    uint64_t ctree2 = bench< ls::vector< int32_t >, compressed_tree, ls::avx_tag >( "ctree AVX ...", runSize, loop );
 #endif // LITESIMD_HAS_AVX
 
-        if( g_verbose )
-        {
+    if( g_verbose )
+    {
+        // The std::map of the large size does not fit on the memory
+        if( runSize <= 0x00400000 )
             bench< ls::vector< int32_t >, map_index, void >( "std::map ....", runSize, loop );
 
-            std::cout
-                      << std::endl << "Index Speed up SSE.......: " << std::fixed << std::setprecision(2)
-                      << static_cast<float>(base)/static_cast<float>(index1) << "x"
+        std::cout
+                  << std::endl << "Index Speed up SSE.......: " << std::fixed << std::setprecision(2)
+                  << static_cast<float>(base)/static_cast<float>(index1) << "x"
 
 #ifdef LITESIMD_HAS_AVX
-                      << std::endl << "Index Speed up AVX.......: " << std::fixed << std::setprecision(2)
-                      << static_cast<float>(base)/static_cast<float>(index2) << "x"
+                  << std::endl << "Index Speed up AVX.......: " << std::fixed << std::setprecision(2)
+                  << static_cast<float>(base)/static_cast<float>(index2) << "x"
 #endif // LITESIMD_HAS_AVX
 
-                      << std::endl << std::endl;
-        }
-        else
-        {
-            std::cout
-                << base << ","
-                << index1 << ","
+                  << std::endl << "Tree Speed up SSE........: " << std::fixed << std::setprecision(2)
+                  << static_cast<float>(base)/static_cast<float>(tree1) << "x"
+
 #ifdef LITESIMD_HAS_AVX
-                << index2
+                  << std::endl << "Tree Speed up AVX........: " << std::fixed << std::setprecision(2)
+                  << static_cast<float>(base)/static_cast<float>(tree2) << "x"
 #endif // LITESIMD_HAS_AVX
-                << std::endl;
-        }
+
+                  << std::endl << "CTree Speed up SSE.......: " << std::fixed << std::setprecision(2)
+                  << static_cast<float>(base)/static_cast<float>(ctree1) << "x"
+
+#ifdef LITESIMD_HAS_AVX
+                  << std::endl << "CTree Speed up AVX.......: " << std::fixed << std::setprecision(2)
+                  << static_cast<float>(base)/static_cast<float>(ctree2) << "x"
+#endif // LITESIMD_HAS_AVX
+
+                  << std::endl << std::endl;
+    }
+    else
+    {
+        std::cout
+            << runSize << ","
+            << base << ","
+            << index1 << ","
+#ifdef LITESIMD_HAS_AVX
+            << index2 << ","
+#endif // LITESIMD_HAS_AVX
+            << tree1 << ","
+#ifdef LITESIMD_HAS_AVX
+            << tree2 << ","
+#endif // LITESIMD_HAS_AVX
+            << ctree1
+#ifdef LITESIMD_HAS_AVX
+            << "," << ctree2
+#endif // LITESIMD_HAS_AVX
+            << std::endl;
+    }
+}
+
+int main(int argc, char* /*argv*/[])
+{
+    // 4M keys fit on the L3 cache of the large machines, 256M keys (1GB) do not
+    constexpr size_t runSizes[] = { 0x00400000, 0x10000000 };
+    if( argc > 1 )
+    {
+        g_verbose = false;
+        std::cout << "size,base,index_sse,index_avx,tree_sse,tree_avx,ctree_sse,ctree_avx" << std::endl;
+    }
+    while( 1 )
+    {
+        for( size_t runSize : runSizes )
+            run( runSize );
     }
     return 0;
 }
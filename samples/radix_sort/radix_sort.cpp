@@ -0,0 +1,197 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdlib>
+#include <boost/timer/timer.hpp>
+
+#include <litesimd/algorithm/sort.h>
+#include <litesimd/algorithm/radix_sort.h>
+#include <litesimd/helpers/containers.h>
+
+bool g_verbose = true;
+namespace ls = litesimd;
+
+// All keys are positive int32_t values, so the same data is sorted by ls::sort
+enum class distribution { uniform, skewed };
+
+int32_t random_key( distribution dist )
+{
+    if( dist == distribution::uniform )
+        return rand();
+
+    // Most keys are small, with a long tail of big ones
+    return rand() >> (rand() % 24);
+}
+
+template< class Cont_T, typename TAG_T >
+struct stl_sort
+{
+	using container_type = Cont_T;
+
+    void sort( container_type& cont )
+    {
+        std::sort( std::begin( cont ), std::end( cont ) );
+    }
+};
+
+template< class Cont_T, typename TAG_T >
+struct ls_sort
+{
+	using container_type = Cont_T;
+
+    void sort( container_type& cont )
+    {
+        ls::sort< TAG_T >( cont.data(), cont.data() + cont.size() );
+    }
+};
+
+template< class Cont_T, typename TAG_T >
+struct radix_sort
+{
+	using container_type = Cont_T;
+
+    void sort( container_type& cont )
+    {
+        ls::radix_sort< TAG_T >( cont.data(), cont.size() );
+    }
+};
+
+template< class Cont_T, typename TAG_T >
+struct radix_sort11
+{
+	using container_type = Cont_T;
+
+    void sort( container_type& cont )
+    {
+        ls::radix_sort< TAG_T, 11 >( cont.data(), cont.size() );
+    }
+};
+
+template< class Cont_T, template< typename...> class Sort_T, typename TAG_T >
+uint64_t bench( const std::string& name, distribution dist, size_t size, size_t loop )
+{
+	using container_type = Cont_T;
+    using value_type = typename container_type::value_type;
+    using sort_type = Sort_T< container_type, TAG_T >;
+
+    boost::timer::cpu_timer timer;
+    container_type org;
+
+    srand(1);
+    std::generate_n( std::back_inserter(org), size,
+                     [dist](){ return static_cast< value_type >( random_key( dist ) ); } );
+
+    sort_type sort;
+    container_type warmup( org );
+    sort.sort( warmup );
+    if( !std::is_sorted( warmup.begin(), warmup.end() ) )
+        std::cout << name << " not sorted" << std::endl;
+
+    timer.start();
+    for( size_t j = 0; j < loop; ++j )
+    {
+        container_type temp( org );
+        sort.sort( temp );
+    }
+    timer.stop();
+    if( g_verbose )
+        std::cout << "Sort all " << name << ": " << timer.format();
+
+    return timer.elapsed().wall;
+}
+
+int main(int argc, char* /*argv*/[])
+{
+    constexpr size_t runSize = 0x00400000;
+    constexpr size_t loop = 5;
+    if( argc > 1 )
+    {
+        g_verbose = false;
+        std::cout << "Distribution,STL sort,SSE ls::sort,SSE radix_sort,AVX ls::sort,AVX radix_sort" << std::endl << std::endl << std::endl << std::endl;
+    }
+    else
+    {
+        std::cout << "\nsize: 0x" << std::hex << std::setw(8) << std::setfill( '0') << runSize << std::endl << std::endl;
+    }
+    while( 1 )
+    {
+        for( distribution dist : { distribution::uniform, distribution::skewed } )
+        {
+            std::string dist_name = dist == distribution::uniform ? "uniform" : "skewed ";
+            if( g_verbose )
+                std::cout << dist_name << std::endl;
+
+            uint64_t stlsort = bench< ls::vector< uint32_t >, stl_sort, void >( "STL sort ..........", dist, runSize, loop );
+            uint64_t ssequick = bench< ls::vector< int32_t >, ls_sort,
+                                     ls::sse_tag >( "SSE ls::sort ......", dist, runSize, loop );
+            uint64_t sseradix = bench< ls::vector< uint32_t >, radix_sort,
+                                     ls::sse_tag >( "SSE radix_sort ....", dist, runSize, loop );
+#ifdef LITESIMD_HAS_AVX
+            uint64_t avxquick = bench< ls::vector< int32_t >, ls_sort,
+                                     ls::avx_tag >( "AVX ls::sort ......", dist, runSize, loop );
+            uint64_t avxradix = bench< ls::vector< uint32_t >, radix_sort,
+                                     ls::avx_tag >( "AVX radix_sort ....", dist, runSize, loop );
+#endif
+
+            if( g_verbose )
+            {
+#ifdef LITESIMD_HAS_AVX
+                uint64_t avxradix11 = bench< ls::vector< uint32_t >, radix_sort11,
+                                           ls::avx_tag >( "AVX radix_sort 11b ", dist, runSize, loop );
+#endif
+                std::cout
+                    << std::endl << "SSE ls::sort/STL ......: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(stlsort)/static_cast<float>(ssequick) << "x"
+                    << std::endl << "SSE radix_sort/STL ....: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(stlsort)/static_cast<float>(sseradix) << "x"
+#ifdef LITESIMD_HAS_AVX
+                    << std::endl << "AVX ls::sort/STL ......: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(stlsort)/static_cast<float>(avxquick) << "x"
+                    << std::endl << "AVX radix_sort/STL ....: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(stlsort)/static_cast<float>(avxradix) << "x"
+                    << std::endl << "AVX radix 11b/STL .....: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(stlsort)/static_cast<float>(avxradix11) << "x"
+                    << std::endl << "AVX radix/ls::sort ....: " << std::fixed << std::setprecision(2)
+                    << static_cast<float>(avxquick)/static_cast<float>(avxradix) << "x"
+#endif
+                    << std::endl << std::endl;
+            }
+            else
+            {
+                std::cout
+                    << dist_name
+                    << "," << stlsort
+                    << "," << ssequick
+                    << "," << sseradix
+#ifdef LITESIMD_HAS_AVX
+                    << "," << avxquick
+                    << "," << avxradix
+#endif
+                    << std::endl;
+            }
+        }
+    }
+    return 0;
+}
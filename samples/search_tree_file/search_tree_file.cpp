@@ -0,0 +1,155 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <fstream>
+#include <algorithm>
+#include <boost/timer/timer.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <litesimd/types.h>
+#include <litesimd/helpers/containers.h>
+#include <litesimd/container/static_search_tree.h>
+#include <litesimd/container/static_search_tree_view.h>
+
+bool g_verbose = true;
+namespace ls = litesimd;
+namespace bip = boost::interprocess;
+
+void do_nothing( int32_t );
+
+template< class Tree_T >
+uint64_t find_all( const std::string& name, const Tree_T& tree, const ls::vector< int32_t >& keys )
+{
+    boost::timer::cpu_timer timer;
+    for( auto i : keys )
+    {
+        do_nothing( *tree.find( i ) );
+    }
+    timer.stop();
+    if( g_verbose )
+        std::cout << "Find all " << name << ": " << timer.format();
+
+    return timer.elapsed().wall;
+}
+
+int main(int argc, char* /*argv*/[])
+{
+    using tree_type = ls::static_search_tree< int32_t >;
+    using view_type = ls::static_search_tree_view< int32_t >;
+
+    constexpr size_t runSize = 0x02000000;
+    const char* fileName = "search_tree_file.bin";
+    if( argc > 1 )
+    {
+        g_verbose = false;
+        std::cout << "build,parallel_build,save,map,find_tree,find_view" << std::endl;
+    }
+    else
+    {
+        std::cout << "\nsize: 0x" << std::hex << std::setw(8) << std::setfill( '0') << runSize
+                  << std::dec << ", threads: " << std::thread::hardware_concurrency() << std::endl << std::endl;
+    }
+
+    ls::vector< int32_t > org;
+    srand( 1 );
+    std::generate_n( std::back_inserter(org), runSize, &rand );
+    ls::vector< int32_t > sorted( org );
+    std::sort( sorted.begin(), sorted.end() );
+
+    while( 1 )
+    {
+        boost::timer::cpu_timer timer;
+        tree_type tree( sorted.begin(), sorted.end() );
+        timer.stop();
+        uint64_t build = timer.elapsed().wall;
+        if( g_verbose )
+            std::cout << "Build tree ........: " << timer.format();
+
+        // One thread for each core
+        timer.start();
+        {
+            tree_type parallel( sorted.begin(), sorted.end(), 0 );
+            timer.stop();
+        }
+        uint64_t parallel_build = timer.elapsed().wall;
+        if( g_verbose )
+            std::cout << "Parallel build ....: " << timer.format();
+
+        timer.start();
+        {
+            std::ofstream out( fileName, std::ios::binary | std::ios::trunc );
+            tree.save( out );
+        }
+        timer.stop();
+        uint64_t save = timer.elapsed().wall;
+        if( g_verbose )
+            std::cout << "Save tree .........: " << timer.format();
+
+        // The view is ready to search as soon as the file is mapped, the pages are read
+        // from the page cache by the first searches
+        timer.start();
+        bip::file_mapping file( fileName, bip::read_only );
+        bip::mapped_region region( file, bip::read_only );
+        view_type view( region.get_address(), region.get_size() );
+        if( !view.valid() )
+        {
+            std::cerr << "Invalid file " << fileName << std::endl;
+            return 1;
+        }
+        do_nothing( *view.find( org.front() ) );
+        timer.stop();
+        uint64_t map = timer.elapsed().wall;
+        if( g_verbose )
+            std::cout << "Map and find ......: " << timer.format();
+
+        uint64_t find_tree = find_all( "tree ......", tree, org );
+        uint64_t find_view = find_all( "view ......", view, org );
+
+        if( g_verbose )
+        {
+            std::cout
+                      << std::endl << "Parallel build speed up ..: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(build)/static_cast<float>(parallel_build) << "x"
+                      << std::endl << "Startup speed up .........: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(build)/static_cast<float>(map) << "x"
+                      << std::endl << "Find speed up of view ....: " << std::fixed << std::setprecision(2)
+                      << static_cast<float>(find_tree)/static_cast<float>(find_view) << "x"
+                      << std::endl << std::endl;
+        }
+        else
+        {
+            std::cout
+                << build << ","
+                << parallel_build << ","
+                << save << ","
+                << map << ","
+                << find_tree << ","
+                << find_view
+                << std::endl;
+        }
+    }
+    return 0;
+}
@@ -32,6 +32,7 @@
 #include <litesimd/bitwise.h>
 #include <litesimd/shuffle.h>
 #include <litesimd/arithmetic.h>
+#include <litesimd/algorithm.h>
 #include <litesimd/helpers/containers.h>
 
 bool g_verbose = true;
@@ -43,8 +44,8 @@ struct default_simd_to_lower
     {
         ls::t_int8_simd* data = (ls::t_int8_simd*) str.data();
 
-        size_t sz = str.size() & ~(ls::t_int32_simd::simd_size-1);
-        for( size_t i = 0; i < sz; i += ls::t_int32_simd::simd_size)
+        size_t sz = str.size() & ~(ls::t_int8_simd::simd_size-1);
+        for( size_t i = 0; i < sz; i += ls::t_int8_simd::simd_size)
         {
             *data = ls::blend< int8_t >(
                         ls::bit_and< int8_t >(
@@ -93,6 +94,31 @@ struct to_lower
     }
 };
 
+template< typename TAG_T >
+struct transform_to_lower
+{
+    void operator()( ls::string& str )
+    {
+        using simd_type = ls::simd_type< int8_t, TAG_T >;
+
+        int8_t* data = reinterpret_cast< int8_t* >( &str[ 0 ] );
+        ls::transform< TAG_T >( data, data + str.size(), data,
+            []( simd_type val )
+            {
+                return ls::blend< int8_t, TAG_T >(
+                            ls::bit_and< int8_t, TAG_T >(
+                                ls::greater< int8_t, TAG_T >( val, 'A'-1 ),
+                                ls::greater< int8_t, TAG_T >( 'Z'+1, val ) ),
+                            ls::add< int8_t, TAG_T >( val, 0x20 ),
+                            val );
+            },
+            []( int8_t val )
+            {
+                return static_cast< int8_t >( ( 'A' <= val && val <= 'Z' ) ? val + 0x20 : val );
+            } );
+    }
+};
+
 template< typename TAG_T >
 void maskstore( ls::simd_type< int8_t, TAG_T >*,
                 ls::simd_type< int8_t, TAG_T >,
@@ -235,6 +261,10 @@ int main(int argc, char* /*argv*/[])
 
         if( g_verbose )
         {
+            bench< transform_to_lower< ls::sse_tag > >( "TR SSE ", runSize, loop );
+#ifdef LITESIMD_HAS_AVX
+            bench< transform_to_lower< ls::avx_tag > >( "TR AVX ", runSize, loop );
+#endif // LITESIMD_HAS_AVX
             bench< maskmove_to_lower< ls::sse_tag > >( "MM SSE ", runSize, loop );
 #ifdef LITESIMD_HAS_AVX
             bench< maskmove_to_lower< ls::avx_tag > >( "MM AVX ", runSize, loop );
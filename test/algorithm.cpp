@@ -20,6 +20,9 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <limits>
+#include <vector>
+#include <algorithm>
 #include <functional>
 #include <litesimd/types.h>
 #include <litesimd/algorithm.h>
@@ -132,6 +135,92 @@ TYPED_TEST(AlgorithmTypedTest, MinMaxTypedTest)
 }
 
 
+TYPED_TEST(AlgorithmTypedTest, ReduceTypedTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using sum_type = typename ls::reduce_sum_type< type >::type;
+
+    for( size_t size : { 0, 1, 7, 67, 1003 } )
+    {
+        std::vector< type > values( size );
+        for( size_t i = 0; i < size; ++i )
+            values[ i ] = static_cast< type >( (i * 37) % 101 ) - static_cast< type >( 50 );
+
+        if( size > 0 )
+        {
+            values[ size / 2 ] = std::numeric_limits< type >::max();
+            values[ size / 3 ] = std::numeric_limits< type >::lowest();
+        }
+
+        sum_type expected_sum = 0;
+        type expected_min = std::numeric_limits< type >::max();
+        type expected_max = std::numeric_limits< type >::lowest();
+        for( type v : values )
+        {
+            expected_sum += v;
+            expected_min = std::min( expected_min, v );
+            expected_max = std::max( expected_max, v );
+        }
+
+        const type* first = values.data();
+        const type* last = values.data() + size;
+        if( std::is_integral< type >::value )
+        {
+            EXPECT_EQ( expected_sum, (ls::reduce_sum< type, tag >( first, last )) ) << "Size " << size;
+        }
+        EXPECT_EQ( expected_min, (ls::reduce_min< type, tag >( first, last )) ) << "Size " << size;
+        EXPECT_EQ( expected_max, (ls::reduce_max< type, tag >( first, last )) ) << "Size " << size;
+
+        auto minmax = ls::reduce_minmax< type, tag >( first, last );
+        EXPECT_EQ( expected_min, minmax.first ) << "Size " << size;
+        EXPECT_EQ( expected_max, minmax.second ) << "Size " << size;
+    }
+}
+
+
+TYPED_TEST(AlgorithmTypedTest, TransformTypedTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using simd = ls::simd_type< type, tag >;
+
+    auto simd_fn = []( simd val ) { return ls::add< type, tag >( val, simd( 3 ) ); };
+    auto scalar_fn = []( type val ) { return static_cast< type >( val + 3 ); };
+    auto simd_bin = []( simd lhs, simd rhs ) { return ls::sub< type, tag >( lhs, rhs ); };
+    auto scalar_bin = []( type lhs, type rhs ) { return static_cast< type >( lhs - rhs ); };
+
+    for( size_t size : { 0, 1, 7, 67, 1003 } )
+    {
+        for( size_t offset : { 0, 1 } )
+        {
+            std::vector< type > in( size + offset ), out( size + offset, 0 );
+            for( size_t i = 0; i < in.size(); ++i )
+                in[ i ] = static_cast< type >( i % 100 );
+
+            const type* first = in.data() + offset;
+            type* ret = ls::transform< tag >( first, first + size, out.data() + offset, simd_fn, scalar_fn );
+            EXPECT_EQ( out.data() + offset + size, ret );
+            for( size_t i = offset; i < size + offset; ++i )
+            {
+                EXPECT_EQ( static_cast< type >( i % 100 + 3 ), out[ i ] ) << "Size " << size << " index " << i;
+            }
+
+            // In place and unrolled twice
+            ls::transform< tag, 2 >( first, first + size, in.data() + offset, simd_fn, scalar_fn );
+            EXPECT_EQ( out, in ) << "Size " << size;
+
+            // Binary, non-temporal
+            ls::transform< tag >( first, first + size, out.data() + offset, out.data() + offset,
+                                  simd_bin, scalar_bin, ls::non_temporal_store() );
+            for( size_t i = offset; i < size + offset; ++i )
+            {
+                EXPECT_EQ( static_cast< type >( 0 ), out[ i ] ) << "Size " << size << " index " << i;
+            }
+        }
+    }
+}
+
 #endif //__SSE2__
 
 TEST(AlgorithmTest, ForEachIndexTest)
@@ -304,3 +393,163 @@ TEST(AlgorithmTest, ForEachIndexTest)
     } );
     EXPECT_EQ( -1, expected );
 }
+
+#ifdef __SSE2__
+TEST(AlgorithmTest, WidenSumTest)
+{
+    using wide = ls::simd_type< int64_t, ls::sse_tag >;
+    struct op{ wide operator()( wide lhs, wide rhs ) { return ls::add< int64_t, ls::sse_tag >( lhs, rhs ); } };
+
+    EXPECT_EQ( 127 * 16, ls::horizontal( ls::widen_sum( ls::simd_type< int8_t, ls::sse_tag >( 127 ) ), op() ) );
+    EXPECT_EQ( -128 * 16, ls::horizontal( ls::widen_sum( ls::simd_type< int8_t, ls::sse_tag >( -128 ) ), op() ) );
+    EXPECT_EQ( 32767 * 8, ls::horizontal( ls::widen_sum( ls::simd_type< int16_t, ls::sse_tag >( 32767 ) ), op() ) );
+    EXPECT_EQ( -32768 * 8, ls::horizontal( ls::widen_sum( ls::simd_type< int16_t, ls::sse_tag >( -32768 ) ), op() ) );
+    EXPECT_EQ( 0x7fffffffLL * 4, ls::horizontal( ls::widen_sum( ls::simd_type< int32_t, ls::sse_tag >( 0x7fffffff ) ), op() ) );
+
+    wide sum = ls::widen_sum( ls::simd_type< int32_t, ls::sse_tag >( 0x7fffffff, 0x7fffffff, -1, 3 ) );
+    EXPECT_EQ( 0xfffffffeLL + 2, ls::horizontal( sum, op() ) );
+}
+#endif //__SSE2__
+
+TEST(AlgorithmTest, ReduceSumFloatTest)
+{
+    std::vector< float > values( 1000003, 0.1f );
+    const float* first = values.data();
+    const float* last = values.data() + values.size();
+    double expected = 0.1f * static_cast< double >( values.size() );
+
+    float plain = ls::reduce_sum( first, last );
+    float pairwise = ls::reduce_sum( first, last, ls::pairwise_summation() );
+    float kahan = ls::reduce_sum( first, last, ls::kahan_summation() );
+
+    EXPECT_NEAR( expected, plain, expected * 1e-3 );
+    EXPECT_NEAR( expected, pairwise, expected * 1e-5 );
+    EXPECT_NEAR( expected, kahan, expected * 1e-6 );
+
+    std::vector< double > empty;
+    EXPECT_EQ( 0.0, ls::reduce_sum( empty.data(), empty.data(), ls::kahan_summation() ) );
+    EXPECT_EQ( 0.0, ls::reduce_sum( empty.data(), empty.data(), ls::pairwise_summation() ) );
+}
+
+template <typename T> class HistogramTypedTest: public ::testing::Test {};
+
+using HistogramTypes = ::testing::Types<
+#ifdef __SSE2__
+    std::pair<int8_t, ls::sse_tag>, std::pair<int16_t, ls::sse_tag>,
+    std::pair<int32_t, ls::sse_tag>, std::pair<float, ls::sse_tag>
+#ifdef __AVX2__
+    , std::pair<int8_t, ls::avx_tag>, std::pair<int16_t, ls::avx_tag>,
+    std::pair<int32_t, ls::avx_tag>, std::pair<float, ls::avx_tag>
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(HistogramTypedTest, HistogramTypes);
+
+template< typename ValueType_T >
+std::vector< size_t > histogram_reference( const std::vector< ValueType_T >& values, size_t bin_count,
+                                           ValueType_T lo, ValueType_T hi )
+{
+    std::vector< size_t > bins( bin_count );
+    float scale = static_cast< float >( bin_count / (static_cast< double >( hi ) - lo) );
+    float last = static_cast< float >( bin_count - 1 );
+    for( ValueType_T v : values )
+    {
+        if( v < lo || !(v < hi) )
+            continue;
+
+        // Integers are on the exact bin, floats are scaled on single precision
+        size_t bin = std::is_integral< ValueType_T >::value
+            ? static_cast< size_t >( static_cast< uint64_t >( static_cast< int64_t >( v ) - lo ) * bin_count /
+                                     static_cast< uint64_t >( static_cast< int64_t >( hi ) - lo ) )
+            : static_cast< size_t >( std::min( (v - lo) * scale, last ) );
+        ++bins[ bin ];
+    }
+    return bins;
+}
+
+#ifdef __SSE2__
+TYPED_TEST(HistogramTypedTest, HistogramTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    std::vector< type > values;
+    for( int i = 0; i < 1003; ++i )
+        values.push_back( static_cast< type >( ((i * 7919) % 256) - 128 ) );
+    values.push_back( std::numeric_limits< type >::max() );
+    values.push_back( std::numeric_limits< type >::lowest() );
+
+    struct test_range { type lo; type hi; size_t bins; };
+    std::vector< test_range > ranges = {
+        { -128, 127, 255 }, { -128, 127, 7 }, { 0, 64, 16 }, { -100, 100, 3 },
+        { -20, 60, 1 }, { 10, 10, 4 }
+    };
+
+    for( const test_range& r : ranges )
+    {
+        std::vector< size_t > bins( r.bins, 1 );
+        ls::histogram< tag >( values.data(), values.data() + values.size(), bins.data(), r.bins, r.lo, r.hi );
+
+        std::vector< size_t > expected = histogram_reference( values, r.bins, r.lo, r.hi );
+        for( size_t i = 0; i < r.bins; ++i )
+        {
+            EXPECT_EQ( expected[ i ] + 1, bins[ i ] )
+                << "Error on bin " << i << " of [" << +r.lo << ", " << +r.hi << ") with " << r.bins << " bins";
+        }
+    }
+}
+#endif //__SSE2__
+
+#ifdef __SSE2__
+TEST(AlgorithmTest, HistogramTest)
+{
+    std::vector< int32_t > values;
+    for( int32_t i = 0; i < 4096; ++i )
+        values.push_back( static_cast< int32_t >( static_cast< uint32_t >( i ) * 1048573u ) );
+
+    std::vector< size_t > bins( 256 );
+    ls::histogram( values.data(), values.data() + values.size(), bins.data(), bins.size(),
+                   std::numeric_limits< int32_t >::lowest(), std::numeric_limits< int32_t >::max() );
+    EXPECT_EQ( histogram_reference( values, bins.size(), std::numeric_limits< int32_t >::lowest(),
+                                    std::numeric_limits< int32_t >::max() ), bins );
+
+    // Large ranges, not the bin count times a power of 2, with values around the bin edges
+    const int64_t ranges[] = { 30000000, 1000000000, 2000000000, 2100000001 };
+    const size_t counts[] = { 3, 7, 10, 100, 1000 };
+    for( int64_t range : ranges )
+    {
+        int32_t lo = static_cast< int32_t >( -range / 3 );
+        int32_t hi = static_cast< int32_t >( lo + range );
+        for( size_t count : counts )
+        {
+            std::vector< int32_t > edges;
+            for( size_t i = 0; i <= count; ++i )
+            {
+                int64_t edge = lo + (static_cast< int64_t >( i ) * range + count - 1) / count;
+                for( int64_t e = std::max< int64_t >( edge - 2, INT32_MIN ); e <= std::min< int64_t >( edge + 2, INT32_MAX ); ++e )
+                    edges.push_back( static_cast< int32_t >( e ) );
+            }
+
+            bins.assign( count, 0 );
+            ls::histogram( edges.data(), edges.data() + edges.size(), bins.data(), count, lo, hi );
+            EXPECT_EQ( histogram_reference( edges, count, lo, hi ), bins ) << "Range " << range << " with " << count << " bins";
+
+            values.clear();
+            for( uint32_t i = 0; i < 4096; ++i )
+                values.push_back( static_cast< int32_t >( lo + static_cast< int64_t >( i * 2654435761u % range ) ) );
+            bins.assign( count, 0 );
+            ls::histogram( values.data(), values.data() + values.size(), bins.data(), count, lo, hi );
+            EXPECT_EQ( histogram_reference( values, count, lo, hi ), bins ) << "Range " << range << " with " << count << " bins";
+        }
+    }
+
+    std::vector< float > fvalues = { 0.1f, 0.2f, 0.4f, 0.5f, 0.6f, 0.9f, 1.5f, -1.0f,
+                                     std::numeric_limits< float >::quiet_NaN(), 0.0f, 1.0f };
+    uint32_t fbins[ 4 ] = {};
+    ls::histogram( fvalues.data(), fvalues.data() + fvalues.size(), fbins, 4, 0.0f, 1.0f );
+    EXPECT_EQ( 3u, fbins[ 0 ] );
+    EXPECT_EQ( 1u, fbins[ 1 ] );
+    EXPECT_EQ( 2u, fbins[ 2 ] );
+    EXPECT_EQ( 1u, fbins[ 3 ] );
+}
+#endif //__SSE2__
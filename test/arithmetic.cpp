@@ -156,4 +156,29 @@ TYPED_TEST(ArithmeticTaggedTest, DivTest)
         return true;
     } );
 }
+
+TYPED_TEST(ArithmeticTaggedTest, ConvertTest)
+{
+    using tag = TypeParam;
+    using simdf = ls::simd_type< float, tag >;
+    using simd32 = ls::simd_type< int32_t, tag >;
+
+    ls::for_each( ls::convert< float >( simd32( -7 ) ), []( int index, float val )
+    {
+        EXPECT_FLOAT_EQ( -7.0f, val ) << "Error on index " << index;
+        return true;
+    } );
+
+    ls::for_each( ls::convert< int32_t >( simdf( 4.7f ) ), []( int index, int32_t val )
+    {
+        EXPECT_EQ( 4, val ) << "Error on index " << index;
+        return true;
+    } );
+
+    ls::for_each( ls::convert< int32_t >( simdf( -2.5f ) ), []( int index, int32_t val )
+    {
+        EXPECT_EQ( -2, val ) << "Error on index " << index;
+        return true;
+    } );
+}
 #endif //__SSE2__
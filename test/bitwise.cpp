@@ -43,6 +43,18 @@ using TestTypes = ::testing::Types<
 >;
 TYPED_TEST_CASE(BitwiseTypedTest, TestTypes);
 
+template <typename T> class BitwiseTaggedTest: public ::testing::Test {};
+
+using TagTypes = ::testing::Types<
+#ifdef __SSE2__
+    ls::sse_tag
+#ifdef __AVX2__
+    , ls::avx_tag
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(BitwiseTaggedTest, TagTypes);
+
 #ifdef __SSE2__
 TYPED_TEST(BitwiseTypedTest, AndTypedTest)
 {
@@ -142,4 +154,49 @@ TYPED_TEST(BitwiseTypedTest, NotTypedTest)
     } );
 }
 
+
+TYPED_TEST(BitwiseTaggedTest, ShiftTest)
+{
+    using tag = TypeParam;
+    using simd16 = ls::simd_type< int16_t, tag >;
+    using simd32 = ls::simd_type< int32_t, tag >;
+    using simd64 = ls::simd_type< int64_t, tag >;
+
+    ls::for_each( ls::bit_shift_left( simd16( 0x0103 ), 4 ), []( int index, int16_t val )
+    {
+        EXPECT_EQ( 0x1030, val ) << "Error on index " << index;
+        return true;
+    } );
+
+    ls::for_each( ls::bit_shift_right( simd16( -16 ), 4 ), []( int index, int16_t val )
+    {
+        EXPECT_EQ( 0x0fff, val ) << "Error on index " << index;
+        return true;
+    } );
+
+    ls::for_each( ls::bit_shift_left( simd32( 0x0103 ), 8 ), []( int index, int32_t val )
+    {
+        EXPECT_EQ( 0x010300, val ) << "Error on index " << index;
+        return true;
+    } );
+
+    ls::for_each( ls::bit_shift_right( simd32( -16 ), 4 ), []( int index, int32_t val )
+    {
+        EXPECT_EQ( 0x0fffffff, val ) << "Error on index " << index;
+        return true;
+    } );
+
+    ls::for_each( ls::bit_shift_left( simd64( 3 ), 40 ), []( int index, int64_t val )
+    {
+        EXPECT_EQ( INT64_C( 3 ) << 40, val ) << "Error on index " << index;
+        return true;
+    } );
+
+    ls::for_each( ls::bit_shift_right( simd64( -1 ), 60 ), []( int index, int64_t val )
+    {
+        EXPECT_EQ( 15, val ) << "Error on index " << index;
+        return true;
+    } );
+}
+
 #endif //__SSE2__
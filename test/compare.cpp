@@ -209,6 +209,72 @@ TYPED_TEST(SimdCompareTypes, OperatorsTypedTest)
     EXPECT_EQ( cmp, cmpEq );
     EXPECT_NE( cmp, cmpDf );
 }
+
+TYPED_TEST(SimdCompareTypes, LaneBitmaskTypedTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using simd = ls::simd_type< type, tag >;
+    constexpr size_t size = ls::simd_type< type, tag >::simd_size;
+
+    simd cmp;
+    type* pCmp = reinterpret_cast<type*>( &cmp );
+    for( size_t i = 0; i < size; ++i )
+        pCmp[ i ] = static_cast<type>( i % 3 );
+
+    uint32_t expected = 0;
+    for( size_t i = 0; i < size; ++i )
+        if( i % 3 == 1 )
+            expected |= 1u << i;
+
+    uint32_t bitmask = ls::mask_to_lane_bitmask< type, tag >( ls::equal_to( cmp, simd( 1 ) ) );
+    EXPECT_EQ( expected, bitmask );
+    EXPECT_EQ( ls::bit_count< tag >( expected ), ls::bit_count< tag >( bitmask ) );
+
+    EXPECT_EQ( 0u, (ls::mask_to_lane_bitmask< type, tag >( simd::zero() )) );
+    EXPECT_EQ( static_cast<int>( size ),
+               ls::bit_count< tag >( ls::mask_to_lane_bitmask< type, tag >( simd::ones() ) ) );
+}
+
+TYPED_TEST(SimdCompareTypes, NodeBitmaskTypedTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using simd = ls::simd_type< type, tag >;
+    constexpr size_t size = 64 / sizeof( type );
+
+    // Sorted node of one cache line: 0, 0, 2, 2, 4, 4, ...
+    type node[ size ];
+    for( size_t i = 0; i < size; ++i )
+        node[ i ] = static_cast< type >( (i / 2) * 2 );
+
+    for( int key = -1; key <= static_cast< int >( size ); ++key )
+    {
+        uint64_t less = 0, greater = 0;
+        int last = -1;
+        for( size_t i = 0; i < size; ++i )
+        {
+            if( node[ i ] < key )
+            {
+                less |= uint64_t( 1 ) << i;
+                last = static_cast< int >( i );
+            }
+            if( node[ i ] > key )
+                greater |= uint64_t( 1 ) << i;
+        }
+
+        simd key_vec( static_cast< type >( key ) );
+        EXPECT_EQ( less, (ls::greater_node_bitmask< size >( key_vec, node )) ) << "Key " << key;
+        EXPECT_EQ( greater, (ls::greater_node_bitmask< size >( node, key_vec )) ) << "Key " << key;
+        EXPECT_EQ( last, (ls::greater_node_last_index< size >( key_vec, node )) ) << "Key " << key;
+        EXPECT_EQ( last + 1, ls::bit_count< tag >( ls::greater_node_bitmask< size >( key_vec, node ) ) ) << "Key " << key;
+
+        // Node of only one register
+        EXPECT_EQ( static_cast< uint64_t >( ls::mask_to_lane_bitmask< type, tag >(
+                        ls::greater< type, tag >( key_vec, ls::load< type, tag >( node ) ) ) ),
+                   (ls::greater_node_bitmask< simd::simd_size >( key_vec, node )) ) << "Key " << key;
+    }
+}
 #endif //__SSE2__
 
 TEST(SimdCompareTest, GreaterThanDefault)
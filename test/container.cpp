@@ -0,0 +1,565 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <random>
+#include <atomic>
+#include <thread>
+#include <limits>
+#include <algorithm>
+#include <litesimd/types.h>
+#include <litesimd/container.h>
+#include "gtest/gtest.h"
+
+namespace ls = litesimd;
+
+template <typename T> class ContainerTypedTest: public ::testing::Test {};
+
+using TestTypes = ::testing::Types<
+#ifdef __SSE2__
+    std::pair<int8_t, ls::sse_tag>, std::pair<int16_t, ls::sse_tag>,
+    std::pair<int32_t, ls::sse_tag>, std::pair<int64_t, ls::sse_tag>,
+    std::pair<uint8_t, ls::sse_tag>, std::pair<uint32_t, ls::sse_tag>,
+    std::pair<uint64_t, ls::sse_tag>,
+    std::pair<float, ls::sse_tag>, std::pair<double, ls::sse_tag>
+#ifdef __AVX2__
+    , std::pair<int8_t, ls::avx_tag>, std::pair<int16_t, ls::avx_tag>,
+    std::pair<int32_t, ls::avx_tag>, std::pair<int64_t, ls::avx_tag>,
+    std::pair<uint8_t, ls::avx_tag>, std::pair<uint32_t, ls::avx_tag>,
+    std::pair<uint64_t, ls::avx_tag>,
+    std::pair<float, ls::avx_tag>, std::pair<double, ls::avx_tag>
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(ContainerTypedTest, TestTypes);
+
+#ifdef __SSE2__
+// Random key of the type, limited to range values when the type is large enough
+template< typename Type_T >
+Type_T random_key( std::mt19937_64& gen, uint64_t range )
+{
+    long double lowest = std::numeric_limits< Type_T >::lowest();
+    long double width = (long double) std::numeric_limits< Type_T >::max() - lowest;
+    uint64_t steps = std::min< uint64_t >( range, static_cast< uint64_t >( std::min< long double >( width, 1e18L ) ) );
+    return static_cast< Type_T >( lowest + width * (gen() % (steps + 1)) / steps );
+}
+
+template< typename Set_T, typename Type_T >
+void check_set( const Set_T& set, const std::set< Type_T >& expected )
+{
+    ASSERT_EQ( expected.size(), set.size() );
+    ASSERT_EQ( expected.empty(), set.empty() );
+    EXPECT_TRUE( std::equal( expected.begin(), expected.end(), set.begin() ) );
+    EXPECT_TRUE( std::equal( expected.rbegin(), expected.rend(),
+                             std::reverse_iterator< typename Set_T::const_iterator >( set.end() ) ) );
+    EXPECT_EQ( static_cast< ptrdiff_t >( expected.size() ), std::distance( set.begin(), set.end() ) );
+}
+
+// Both iterators point to the same key, or both are at the end
+template< typename Set_T, typename Type_T >
+bool same_position( const Set_T& set, typename Set_T::const_iterator it,
+                    const std::set< Type_T >& expected, typename std::set< Type_T >::const_iterator exp_it )
+{
+    if( exp_it == expected.end() )
+        return it == set.end();
+    return it != set.end() && *it == *exp_it;
+}
+
+// Checks both forms of range( lo, hi ) against the expected keys
+template< typename Container_T, typename Type_T >
+void check_range( const Container_T& cont, const std::vector< Type_T >& sorted, Type_T lo, Type_T hi )
+{
+    using register_type = typename Container_T::register_type;
+    constexpr size_t simd_size = register_type::simd_size;
+
+    std::vector< Type_T > expected( std::lower_bound( sorted.begin(), sorted.end(), lo ),
+                                    std::max( std::lower_bound( sorted.begin(), sorted.end(), lo ),
+                                              std::lower_bound( sorted.begin(), sorted.end(), hi ) ) );
+
+    auto range = cont.range( lo, hi );
+    std::vector< Type_T > keys( range.begin(), range.end() );
+    EXPECT_EQ( expected, keys ) << "Range " << +lo << " " << +hi;
+    EXPECT_EQ( expected.empty(), range.empty() ) << "Range " << +lo << " " << +hi;
+
+    keys.clear();
+    cont.range( lo, hi, [&]( register_type reg, uint32_t bitmask ){
+        Type_T lanes[ simd_size ];
+        std::memcpy( lanes, &reg, sizeof( reg ) );
+        EXPECT_NE( 0u, bitmask );
+        for( size_t i = 0; i < simd_size; ++i )
+            if( bitmask & (1u << i) )
+                keys.push_back( lanes[ i ] );
+    });
+    EXPECT_EQ( expected, keys ) << "Range " << +lo << " " << +hi;
+}
+
+TYPED_TEST(ContainerTypedTest, BTreeSetTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using set_type = ls::btree_set< type, tag >;
+
+    std::mt19937_64 gen( 1 );
+    set_type set;
+    std::set< type > expected;
+    check_set( set, expected );
+    EXPECT_EQ( 1u, set.height() );
+
+    // Grows with random inserts, then shrinks with more erases than inserts
+    for( int phase = 0; phase < 2; ++phase )
+    {
+        for( int i = 0; i < 30000; ++i )
+        {
+            type key = random_key< type >( gen, 40000 );
+            if( gen() % 4 < (phase == 0 ? 1u : 3u) )
+            {
+                EXPECT_EQ( expected.erase( key ), set.erase( key ) ) << "Key " << +key;
+            }
+            else
+            {
+                auto ret = set.insert( key );
+                EXPECT_EQ( expected.insert( key ).second, ret.second ) << "Key " << +key;
+                EXPECT_EQ( key, *ret.first ) << "Key " << +key;
+            }
+        }
+        check_set( set, expected );
+
+        for( int i = 0; i < 2000; ++i )
+        {
+            type key = random_key< type >( gen, 40000 );
+            auto range = set.equal_range( key );
+            EXPECT_TRUE( same_position( set, set.lower_bound( key ), expected, expected.lower_bound( key ) ) ) << "Key " << +key;
+            EXPECT_TRUE( same_position( set, set.upper_bound( key ), expected, expected.upper_bound( key ) ) ) << "Key " << +key;
+            EXPECT_TRUE( same_position( set, range.first, expected, expected.lower_bound( key ) ) ) << "Key " << +key;
+            EXPECT_TRUE( same_position( set, range.second, expected, expected.upper_bound( key ) ) ) << "Key " << +key;
+            EXPECT_EQ( expected.count( key ), set.count( key ) ) << "Key " << +key;
+        }
+
+        std::vector< type > sorted( expected.begin(), expected.end() );
+        for( int i = 0; i < 200; ++i )
+        {
+            type lo = random_key< type >( gen, 40000 );
+            type hi = random_key< type >( gen, 40000 );
+            check_range( set, sorted, lo, hi );
+            check_range( set, sorted, std::min( lo, hi ), std::max( lo, hi ) );
+        }
+    }
+
+    // Extremes of the type and the padding value
+    for( type key : { std::numeric_limits< type >::lowest(), std::numeric_limits< type >::max(), type( 0 ) } )
+    {
+        EXPECT_EQ( expected.insert( key ).second, set.insert( key ).second ) << "Key " << +key;
+        EXPECT_TRUE( set.contains( key ) ) << "Key " << +key;
+        EXPECT_TRUE( same_position( set, set.upper_bound( key ), expected, expected.upper_bound( key ) ) ) << "Key " << +key;
+    }
+    check_set( set, expected );
+
+    // Erase by iterator down to the empty set
+    while( !expected.empty() )
+    {
+        auto pos = set.lower_bound( random_key< type >( gen, 40000 ) );
+        if( pos == set.end() )
+            --pos;
+        type key = *pos;
+        auto next = set.erase( pos );
+        auto exp_next = expected.erase( expected.find( key ) );
+        EXPECT_TRUE( same_position( set, next, expected, exp_next ) ) << "Key " << +key;
+        if( expected.size() % 1000 == 0 )
+            check_set( set, expected );
+    }
+    check_set( set, expected );
+    EXPECT_EQ( 1u, set.height() );
+}
+
+TYPED_TEST(ContainerTypedTest, BTreeSetBulkLoadTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using set_type = ls::btree_set< type, tag >;
+
+    std::mt19937_64 gen( 2 );
+    for( size_t n : { 0, 1, 2, 31, 32, 33, 100, 1000, 20000 } )
+    {
+        std::vector< type > keys;
+        for( size_t i = 0; i < n; ++i )
+            keys.push_back( random_key< type >( gen, 1000000 ) );
+
+        std::set< type > expected( keys.begin(), keys.end() );
+        set_type set( keys.begin(), keys.end() );
+        check_set( set, expected );
+
+        set_type copy( set );
+        check_set( copy, expected );
+
+        // Mutations after the bulk load rebalance the tree
+        for( size_t i = 0; i < n; ++i )
+        {
+            type key = keys[ i ];
+            if( i % 3 == 0 )
+            {
+                EXPECT_EQ( expected.erase( key ), copy.erase( key ) ) << "Key " << +key;
+            }
+            else
+            {
+                key = random_key< type >( gen, 1000000 );
+                EXPECT_EQ( expected.insert( key ).second, copy.insert( key ).second ) << "Key " << +key;
+            }
+        }
+        check_set( copy, expected );
+
+        set_type moved( std::move( copy ) );
+        check_set( moved, expected );
+        EXPECT_TRUE( copy.empty() );
+        EXPECT_EQ( copy.begin(), copy.end() );
+
+        set = moved;
+        check_set( set, expected );
+
+        std::vector< type > sorted( expected.begin(), expected.end() );
+        set.bulk_load( sorted.begin(), sorted.end() );
+        check_set( set, expected );
+
+        type lowest = std::numeric_limits< type >::lowest();
+        type highest = std::numeric_limits< type >::max();
+        check_range( set, sorted, lowest, highest );
+        if( !sorted.empty() )
+        {
+            check_range( set, sorted, sorted.front(), sorted.back() );
+            check_range( set, sorted, sorted[ n / 3 ], highest );
+        }
+
+        // The static tree is built from the same keys
+        ls::static_search_tree< type, tag > tree( sorted.begin(), sorted.end() );
+        check_range( tree, sorted, lowest, highest );
+        for( int i = 0; i < 200; ++i )
+        {
+            type lo = random_key< type >( gen, 1000000 );
+            type hi = random_key< type >( gen, 1000000 );
+            check_range( tree, sorted, std::min( lo, hi ), std::max( lo, hi ) );
+            check_range( tree, sorted, lo, hi );
+        }
+    }
+}
+#endif //__SSE2__
+
+template <typename T> class EytzingerTypedTest: public ::testing::Test {};
+TYPED_TEST_CASE(EytzingerTypedTest, TestTypes);
+
+template< typename Array_T, typename Type_T >
+void check_eytzinger( const Array_T& array, const std::vector< Type_T >& keys,
+                      const std::vector< Type_T >& search )
+{
+    ASSERT_EQ( keys.size(), array.size() );
+    ASSERT_EQ( keys.empty(), array.empty() );
+
+    std::vector< Type_T > slots( array.begin(), array.end() );
+    std::sort( slots.begin(), slots.end() );
+    EXPECT_TRUE( std::equal( keys.begin(), keys.end(), slots.begin() ) ) << "Size " << keys.size();
+
+    for( Type_T key : search )
+    {
+        auto lower = std::lower_bound( keys.begin(), keys.end(), key );
+        auto upper = std::upper_bound( keys.begin(), keys.end(), key );
+        bool found = std::binary_search( keys.begin(), keys.end(), key );
+
+        auto it = array.lower_bound( key );
+        ASSERT_EQ( lower == keys.end(), it == array.end() ) << "Size " << keys.size() << " key " << +key;
+        if( lower != keys.end() )
+        {
+            ASSERT_EQ( *lower, *it ) << "Size " << keys.size() << " key " << +key;
+        }
+
+        it = array.upper_bound( key );
+        ASSERT_EQ( upper == keys.end(), it == array.end() ) << "Size " << keys.size() << " key " << +key;
+        if( upper != keys.end() )
+        {
+            ASSERT_EQ( *upper, *it ) << "Size " << keys.size() << " key " << +key;
+        }
+
+        EXPECT_EQ( found, array.contains( key ) ) << "Size " << keys.size() << " key " << +key;
+        if( found )
+        {
+            EXPECT_EQ( key, *array.find( key ) ) << "Size " << keys.size() << " key " << +key;
+        }
+    }
+}
+
+#ifdef __SSE2__
+TYPED_TEST(EytzingerTypedTest, EytzingerArrayTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    constexpr size_t line = 64 / sizeof( type );
+
+    std::mt19937_64 gen( 7 );
+    type lowest = std::numeric_limits< type >::lowest();
+    type highest = std::numeric_limits< type >::max();
+
+    for( uint64_t range : { UINT64_C( 1 ) << 62, UINT64_C( 100 ) } )
+    {
+        for( size_t n : { 0, 1, 2, 15, 16, 17, 100, 1000, 4097 } )
+        {
+            std::vector< type > keys;
+            for( size_t i = 0; i < n; ++i )
+                keys.push_back( random_key< type >( gen, range ) );
+            if( n > 2 )
+            {
+                keys[ 0 ] = lowest;
+                keys[ 1 ] = highest;
+            }
+            std::sort( keys.begin(), keys.end() );
+
+            std::vector< type > search( keys );
+            search.push_back( lowest );
+            search.push_back( highest );
+            for( size_t i = 0; i < 200; ++i )
+                search.push_back( random_key< type >( gen, range ) );
+
+            check_eytzinger( ls::eytzinger_array< type, tag >( keys.begin(), keys.end() ), keys, search );
+            check_eytzinger( ls::eytzinger_array< type, tag, line >( keys.begin(), keys.end() ), keys, search );
+        }
+    }
+}
+#endif //__SSE2__
+
+template <typename T> class HashTableTypedTest: public ::testing::Test {};
+
+using HashTableTypes = ::testing::Types<
+#ifdef __SSE2__
+ls::sse_tag
+#ifdef __AVX2__
+, ls::avx_tag
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(HashTableTypedTest, HashTableTypes);
+
+#ifdef __SSE2__
+TYPED_TEST(HashTableTypedTest, FlatHashSetTest)
+{
+    using tag = TypeParam;
+    using set_type = ls::flat_hash_set< int64_t, std::hash< int64_t >, std::equal_to< int64_t >, tag >;
+
+    std::mt19937_64 gen( 11 );
+    set_type set;
+    std::set< int64_t > expected;
+    EXPECT_TRUE( set.empty() );
+    EXPECT_FALSE( set.contains( 0 ) );
+    EXPECT_TRUE( set.begin() == set.end() );
+
+    // Inserts and erases on a small range, leaving many deleted slots, then a large range
+    for( int64_t range : { 1000, 100000 } )
+    {
+        for( size_t i = 0; i < 50000; ++i )
+        {
+            int64_t key = static_cast< int64_t >( gen() % range ) * 64;
+            if( gen() % 3 == 0 )
+            {
+                ASSERT_EQ( expected.erase( key ), set.erase( key ) ) << "Key " << key;
+            }
+            else
+            {
+                auto ret = set.insert( key );
+                ASSERT_EQ( expected.insert( key ).second, ret.second ) << "Key " << key;
+                ASSERT_EQ( key, *ret.first ) << "Key " << key;
+            }
+        }
+
+        ASSERT_EQ( expected.size(), set.size() );
+        EXPECT_LE( set.size(), set.capacity() - set.capacity() / 8 );
+        std::vector< int64_t > keys( set.begin(), set.end() );
+        std::sort( keys.begin(), keys.end() );
+        EXPECT_TRUE( std::equal( expected.begin(), expected.end(), keys.begin() ) );
+        EXPECT_EQ( expected.size(), keys.size() );
+
+        for( int64_t key = -64; key < range * 64; key += 32 )
+        {
+            EXPECT_EQ( expected.count( key ), set.count( key ) ) << "Key " << key;
+            EXPECT_EQ( expected.count( key ) != 0, set.find( key ) != set.end() ) << "Key " << key;
+        }
+    }
+
+    // Erase while iterating, keeping the odd keys
+    for( auto it = set.begin(); it != set.end(); )
+        it = (*it / 64) % 2 ? std::next( it ) : set.erase( it );
+    for( auto it = expected.begin(); it != expected.end(); )
+        it = (*it / 64) % 2 ? std::next( it ) : expected.erase( it );
+    ASSERT_EQ( expected.size(), set.size() );
+    for( int64_t key : expected )
+        EXPECT_TRUE( set.contains( key ) ) << "Key " << key;
+
+    set_type copy( set );
+    set_type moved( std::move( copy ) );
+    EXPECT_EQ( set.size(), moved.size() );
+    for( int64_t key : expected )
+        EXPECT_TRUE( moved.contains( key ) ) << "Key " << key;
+
+    set.clear();
+    EXPECT_TRUE( set.empty() );
+    EXPECT_FALSE( set.contains( *expected.begin() ) );
+    EXPECT_TRUE( set.begin() == set.end() );
+    EXPECT_TRUE( set.insert( 5 ).second );
+    EXPECT_TRUE( set.emplace( 6 ).second );
+    EXPECT_FALSE( set.emplace( 5 ).second );
+    EXPECT_EQ( 2u, set.size() );
+}
+
+TYPED_TEST(HashTableTypedTest, FlatHashMapTest)
+{
+    using tag = TypeParam;
+    using map_type = ls::flat_hash_map< std::string, int, std::hash< std::string >, std::equal_to< std::string >, tag >;
+
+    map_type map;
+    for( int i = 0; i < 5000; ++i )
+        map[ std::to_string( i ) ] = i;
+    for( int i = 0; i < 5000; i += 2 )
+        EXPECT_EQ( 1u, map.erase( std::to_string( i ) ) );
+    ASSERT_EQ( 2500u, map.size() );
+
+    EXPECT_FALSE( map.insert( std::make_pair( std::string( "1" ), 100 ) ).second );
+    EXPECT_TRUE( map.insert( std::make_pair( "2", 200 ) ).second );
+    EXPECT_FALSE( map.try_emplace( "3", 300 ).second );
+    EXPECT_TRUE( map.try_emplace( "4", 400 ).second );
+    ++map[ "5" ];
+    map.find( "7" )->second = 70;
+    EXPECT_EQ( 1, map[ "1" ] );
+    EXPECT_EQ( 200, map[ "2" ] );
+    EXPECT_EQ( 3, map.find( "3" )->second );
+    EXPECT_EQ( 400, map[ "4" ] );
+    EXPECT_EQ( 6, map[ "5" ] );
+    EXPECT_EQ( 70, map[ "7" ] );
+    EXPECT_TRUE( map.find( "6" ) == map.end() );
+    EXPECT_EQ( 2502u, map.size() );
+
+    // All values but the 4 changed above are equal to their keys
+    int sum = 0;
+    for( auto& value : map )
+        sum += (std::stoi( value.first ) == value.second) ? 1 : 0;
+    EXPECT_EQ( 2498, sum );
+
+    std::vector< std::string > keys;
+    for( int i = 0; i < 100; ++i )
+        keys.push_back( std::to_string( i ) );
+    std::vector< typename map_type::const_iterator > found( keys.size() + 1 );
+    auto end = map.find_many( keys.begin(), keys.end(), found.begin() );
+    EXPECT_EQ( found.begin() + keys.size(), end );
+    const map_type& cmap = map;
+    for( size_t i = 0; i < keys.size(); ++i )
+        EXPECT_TRUE( cmap.find( keys[ i ] ) == found[ i ] ) << "Key " << keys[ i ];
+}
+#endif //__SSE2__
+
+TYPED_TEST(HashTableTypedTest, ConcurrentHashMapTest)
+{
+    using tag = TypeParam;
+    using map_type = ls::concurrent_hash_map< int64_t, int64_t, std::hash< int64_t >, std::equal_to< int64_t >, tag >;
+
+    std::mt19937_64 gen( 13 );
+    map_type map;
+    std::map< int64_t, int64_t > expected;
+    int64_t value = 0;
+    EXPECT_TRUE( map.empty() );
+    EXPECT_FALSE( map.find( 0, value ) );
+
+    // Growing and shrinking through many migrations, with deleted slots
+    for( int64_t range : { 100, 20000, 2000 } )
+    {
+        for( size_t i = 0; i < 40000; ++i )
+        {
+            int64_t key = static_cast< int64_t >( gen() % range );
+            int op = static_cast< int >( gen() % 4 );
+            if( op == 0 )
+            {
+                ASSERT_EQ( expected.erase( key ), map.erase( key ) ) << "Key " << key;
+            }
+            else if( op == 1 )
+            {
+                ASSERT_EQ( expected.insert( std::make_pair( key, key + i ) ).second, map.insert( key, key + i ) ) << "Key " << key;
+            }
+            else
+            {
+                bool inserted = expected.count( key ) == 0;
+                expected[ key ] = key * 3 + i;
+                ASSERT_EQ( inserted, map.insert_or_assign( key, key * 3 + i ) ) << "Key " << key;
+            }
+        }
+
+        ASSERT_EQ( expected.size(), map.size() );
+        for( int64_t key = -1; key <= range; ++key )
+        {
+            auto it = expected.find( key );
+            ASSERT_EQ( it != expected.end(), map.find( key, value ) ) << "Key " << key;
+            if( it != expected.end() )
+            {
+                EXPECT_EQ( it->second, value ) << "Key " << key;
+            }
+        }
+    }
+    map.reclaim();
+    EXPECT_TRUE( map.contains( expected.begin()->first ) );
+
+    // Readers check the keys never erased and the values of the changing keys, while a
+    // writer grows the map from empty
+    map_type shared;
+    constexpr int64_t stable = 1000;
+    constexpr int64_t changing = 100000;
+    for( int64_t key = 0; key < stable; ++key )
+        shared.insert( key, key * changing );
+
+    std::atomic< bool > done( false );
+    std::atomic< size_t > errors( 0 );
+    std::vector< std::thread > readers;
+    for( int t = 0; t < 3; ++t )
+    {
+        readers.emplace_back( [&shared, &done, &errors, t]()
+        {
+            std::mt19937_64 rgen( t );
+            int64_t found;
+            while( !done.load() )
+            {
+                int64_t key = static_cast< int64_t >( rgen() % (stable + changing) );
+                bool ret = shared.find( key, found );
+                if( (key < stable && !ret) || (ret && found / changing != key) )
+                    errors.fetch_add( 1 );
+            }
+        } );
+    }
+
+    for( int64_t key = stable; key < stable + changing; ++key )
+    {
+        shared.insert( key, key * changing );
+        shared.insert_or_assign( key - stable / 2, (key - stable / 2) * changing + 1 );
+        if( key % 3 == 0 && key - 7 >= stable )
+            shared.erase( key - 7 );
+    }
+    done.store( true );
+    for( auto& reader : readers )
+        reader.join();
+
+    EXPECT_EQ( 0u, errors.load() );
+    for( int64_t key = 0; key < stable; ++key )
+        EXPECT_TRUE( shared.contains( key ) ) << "Key " << key;
+}
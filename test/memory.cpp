@@ -0,0 +1,119 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/algorithm.h>
+#include <litesimd/helpers/iostream.h>
+#include "gtest/gtest.h"
+
+namespace ls = litesimd;
+
+template <typename T> class MemoryTypedTest: public ::testing::Test {};
+
+using TestTypes = ::testing::Types<
+#ifdef __SSE2__
+    std::pair<int8_t, ls::sse_tag>, std::pair<int16_t, ls::sse_tag>,
+    std::pair<int32_t, ls::sse_tag>, std::pair<int64_t, ls::sse_tag>,
+    std::pair<float, ls::sse_tag>, std::pair<double, ls::sse_tag>
+#ifdef __AVX2__
+    , std::pair<int8_t, ls::avx_tag>, std::pair<int16_t, ls::avx_tag>,
+    std::pair<int32_t, ls::avx_tag>, std::pair<int64_t, ls::avx_tag>,
+    std::pair<float, ls::avx_tag>, std::pair<double, ls::avx_tag>
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(MemoryTypedTest, TestTypes);
+
+#ifdef __SSE2__
+TYPED_TEST(MemoryTypedTest, LoadStoreTypedTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using simd = ls::simd_type< type, tag >;
+
+    type array[ 2 * simd::simd_size + 1 ];
+    for( size_t i = 0; i < 2 * simd::simd_size + 1; ++i )
+        array[ i ] = static_cast< type >( i );
+
+    // Unaligned load
+    simd a = ls::load< type, tag >( array + 1 );
+    ls::for_each( a, [&a]( int index, type val )
+    {
+        EXPECT_EQ( static_cast< type >( index + 1 ), val ) << "Error on index " << index << " Simd: " << a;
+        return true;
+    } );
+
+    // Unaligned store
+    ls::store< type, tag >( array + simd::simd_size + 1, ls::iota< type, tag >( 10 ) );
+    EXPECT_EQ( static_cast< type >( simd::simd_size ), array[ simd::simd_size ] );
+    for( size_t i = 0; i < simd::simd_size; ++i )
+    {
+        EXPECT_EQ( static_cast< type >( i + 10 ), array[ simd::simd_size + 1 + i ] ) << "Error on index " << i;
+    }
+}
+#endif //__SSE2__
+
+template <typename T> class MemoryTaggedTest: public ::testing::Test {};
+
+using TagTypes = ::testing::Types<
+#ifdef __SSE2__
+    ls::sse_tag
+#ifdef __AVX2__
+    , ls::avx_tag
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(MemoryTaggedTest, TagTypes);
+
+template< typename Type_T, typename Tag_T >
+void test_gather()
+{
+    using simd = ls::simd_type< Type_T, Tag_T >;
+    using index_type = typename ls::permute_index< Type_T >::type;
+
+    Type_T array[ 64 ];
+    for( int i = 0; i < 64; ++i )
+        array[ i ] = static_cast< Type_T >( 100 + i );
+
+    // Index of each lane: 63, 54, 45, ... wrapping
+    index_type idx[ simd::simd_size ];
+    for( size_t i = 0; i < simd::simd_size; ++i )
+        idx[ i ] = static_cast< index_type >( (63 - 9 * i) % 64 );
+
+    simd vec = ls::gather< Type_T, Tag_T >( array, ls::load< index_type, Tag_T >( idx ) );
+    ls::for_each( vec, [&idx]( int index, Type_T val )
+    {
+        EXPECT_EQ( static_cast< Type_T >( 100 + idx[ index ] ), val ) << "Error on index " << index;
+        return true;
+    } );
+}
+
+#ifdef __SSE2__
+TYPED_TEST(MemoryTaggedTest, GatherTest)
+{
+    test_gather< int32_t, TypeParam >();
+    test_gather< int64_t, TypeParam >();
+    test_gather< float, TypeParam >();
+    test_gather< double, TypeParam >();
+}
+#endif //__SSE2__
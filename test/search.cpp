@@ -0,0 +1,401 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <deque>
+#include <vector>
+#include <random>
+#include <limits>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <litesimd/types.h>
+#include <litesimd/algorithm.h>
+#include <litesimd/container.h>
+#include "gtest/gtest.h"
+
+namespace ls = litesimd;
+
+template <typename T> class SearchTypedTest: public ::testing::Test {};
+
+using TestTypes = ::testing::Types<
+#ifdef __SSE2__
+    std::pair<int8_t, ls::sse_tag>, std::pair<int16_t, ls::sse_tag>,
+    std::pair<int32_t, ls::sse_tag>, std::pair<int64_t, ls::sse_tag>,
+    std::pair<uint8_t, ls::sse_tag>, std::pair<uint32_t, ls::sse_tag>,
+    std::pair<uint64_t, ls::sse_tag>,
+    std::pair<float, ls::sse_tag>, std::pair<double, ls::sse_tag>
+#ifdef __AVX2__
+    , std::pair<int8_t, ls::avx_tag>, std::pair<int16_t, ls::avx_tag>,
+    std::pair<int32_t, ls::avx_tag>, std::pair<int64_t, ls::avx_tag>,
+    std::pair<uint8_t, ls::avx_tag>, std::pair<uint32_t, ls::avx_tag>,
+    std::pair<uint64_t, ls::avx_tag>,
+    std::pair<float, ls::avx_tag>, std::pair<double, ls::avx_tag>
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(SearchTypedTest, TestTypes);
+
+#ifdef __SSE2__
+// Sorted values with repetitions, one of _levels_ values spread on all the range of the type
+template< typename Type_T >
+std::vector< Type_T > sorted_values( size_t size, unsigned seed, uint64_t levels = 256 )
+{
+    std::mt19937_64 gen( seed );
+    std::uniform_int_distribution< uint64_t > dist( 0, levels - 1 );
+    std::vector< Type_T > ret( size );
+    for( auto& v : ret )
+    {
+        long double lowest = std::numeric_limits< Type_T >::lowest();
+        long double range = std::numeric_limits< Type_T >::max() - lowest;
+        v = static_cast< Type_T >( lowest + range * dist( gen ) / levels );
+    }
+    std::sort( ret.begin(), ret.end() );
+    return ret;
+}
+
+// The values, both ends of the type, the middle of consecutive values and the
+// neighbors of some values
+template< typename Type_T >
+std::vector< Type_T > search_keys( const std::vector< Type_T >& values )
+{
+    std::vector< Type_T > keys( values );
+    keys.push_back( std::numeric_limits< Type_T >::lowest() );
+    keys.push_back( std::numeric_limits< Type_T >::max() );
+    for( size_t i = 0; i + 1 < values.size(); ++i )
+        keys.push_back( static_cast< Type_T >( values[ i ] / 2 + values[ i + 1 ] / 2 ) );
+    for( size_t i = 0; i < values.size(); i += 7 )
+    {
+        if( values[ i ] > std::numeric_limits< Type_T >::lowest() )
+            keys.push_back( static_cast< Type_T >( values[ i ] - 1 ) );
+        if( values[ i ] < std::numeric_limits< Type_T >::max() )
+            keys.push_back( static_cast< Type_T >( values[ i ] + 1 ) );
+    }
+    return keys;
+}
+
+// Checks the searches of a sorted container against the std algorithms
+template< typename Index_T, typename Type_T >
+void check_sorted_index( const Index_T& index, const std::vector< Type_T >& values,
+                         const std::vector< Type_T >& keys )
+{
+    const size_t n = values.size();
+    ASSERT_EQ( n, index.size() );
+    EXPECT_EQ( values.empty(), index.empty() );
+    EXPECT_TRUE( std::equal( values.begin(), values.end(), index.begin() ) ) << "Size " << n;
+
+    for( Type_T key : keys )
+    {
+        auto lower = std::lower_bound( values.begin(), values.end(), key ) - values.begin();
+        auto upper = std::upper_bound( values.begin(), values.end(), key ) - values.begin();
+        bool found = std::binary_search( values.begin(), values.end(), key );
+
+        ASSERT_EQ( lower, index.lower_bound( key ) - index.begin() ) << "Size " << n << " key " << +key;
+        ASSERT_EQ( upper, index.upper_bound( key ) - index.begin() ) << "Size " << n << " key " << +key;
+        EXPECT_EQ( found, index.contains( key ) ) << "Size " << n << " key " << +key;
+        EXPECT_EQ( found ? index.begin() + lower : index.end(), index.find( key ) ) << "Size " << n << " key " << +key;
+    }
+}
+
+TYPED_TEST(SearchTypedTest, LowerUpperBoundTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    unsigned seed = 0;
+    for( size_t n : { 0, 1, 31, 32, 33, 100, 1000, 4097 } )
+    {
+        auto values = sorted_values< type >( n, ++seed );
+        for( type key : search_keys( values ) )
+        {
+            auto lower = ls::lower_bound< tag >( values.begin(), values.end(), key );
+            EXPECT_EQ( std::lower_bound( values.begin(), values.end(), key ), lower )
+                << "Size " << n << " key " << +key;
+
+            auto upper = ls::upper_bound< tag >( values.begin(), values.end(), key );
+            EXPECT_EQ( std::upper_bound( values.begin(), values.end(), key ), upper )
+                << "Size " << n << " key " << +key;
+
+            auto range = ls::equal_range< tag >( values.data(), values.data() + n, key );
+            EXPECT_EQ( values.data() + (lower - values.begin()), range.first ) << "Size " << n << " key " << +key;
+            EXPECT_EQ( values.data() + (upper - values.begin()), range.second ) << "Size " << n << " key " << +key;
+        }
+    }
+}
+
+TYPED_TEST(SearchTypedTest, InterpolationLowerBoundTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    unsigned seed = 50;
+    for( size_t n : { 0, 1, 31, 32, 33, 100, 1000, 4097 } )
+    {
+        // Values covering the whole type and a skewed distribution, with most values on
+        // the start of the range, where the interpolation degrades
+        auto values = sorted_values< type >( n, ++seed );
+        auto skewed( values );
+        for( size_t i = 0; i < n; ++i )
+            skewed[ i ] = static_cast< type >( i + 1 < n ? i : std::numeric_limits< type >::max() );
+        std::sort( skewed.begin(), skewed.end() );
+
+        for( auto&& vec : { values, skewed } )
+        {
+            for( type key : search_keys( vec ) )
+            {
+                EXPECT_EQ( std::lower_bound( vec.begin(), vec.end(), key ),
+                           ls::interpolation_lower_bound< tag >( vec.begin(), vec.end(), key ) )
+                    << "Size " << n << " key " << +key;
+            }
+        }
+    }
+}
+
+TYPED_TEST(SearchTypedTest, LowerBoundBatchTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    unsigned seed = 100;
+    for( size_t n : { 0, 1, 2, 31, 100, 4097 } )
+    {
+        auto values = sorted_values< type >( n, ++seed );
+        auto keys = search_keys( values );
+
+        std::vector< size_t > pos( keys.size() + 1, 12345 );
+        auto end = ls::lower_bound_batch< tag >( values.begin(), values.end(), keys.data(), keys.size(), pos.begin() );
+        EXPECT_EQ( pos.begin() + keys.size(), end ) << "Size " << n;
+        EXPECT_EQ( 12345u, pos.back() ) << "Size " << n;
+
+        for( size_t i = 0; i < keys.size(); ++i )
+        {
+            EXPECT_EQ( (size_t) (std::lower_bound( values.begin(), values.end(), keys[ i ] ) - values.begin()), pos[ i ] )
+                << "Size " << n << " key " << +keys[ i ];
+        }
+    }
+}
+
+TYPED_TEST(SearchTypedTest, LowerBoundVerticalTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    unsigned seed = 200;
+    for( size_t n : { 0, 1, 2, 3, 31, 100, 4097 } )
+    {
+        auto values = sorted_values< type >( n, ++seed );
+        auto keys = search_keys( values );
+
+        std::vector< size_t > pos( keys.size() );
+        auto end = ls::lower_bound_vertical< tag >( values.data(), values.data() + n,
+                                                    keys.data(), keys.size(), pos.begin() );
+        EXPECT_EQ( pos.end(), end ) << "Size " << n;
+
+        for( size_t i = 0; i < keys.size(); ++i )
+        {
+            EXPECT_EQ( (size_t) (std::lower_bound( values.begin(), values.end(), keys[ i ] ) - values.begin()), pos[ i ] )
+                << "Size " << n << " key " << +keys[ i ];
+        }
+    }
+}
+
+TYPED_TEST(SearchTypedTest, StaticSearchTreeTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    unsigned seed = 300;
+    for( size_t n : { 0, 1, 15, 16, 17, 100, 1000, 4097, 20000 } )
+    {
+        auto values = sorted_values< type >( n, ++seed );
+        ls::static_search_tree< type, tag > tree( values.begin(), values.end() );
+        EXPECT_EQ( 0u, reinterpret_cast< uintptr_t >( tree.begin() ) % 64 ) << "Size " << n;
+        check_sorted_index( tree, values, search_keys( values ) );
+    }
+}
+
+TYPED_TEST(SearchTypedTest, StaticSearchTreeViewTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    unsigned seed = 400;
+    for( size_t n : { 0, 1, 17, 1000, 4097 } )
+    {
+        auto values = sorted_values< type >( n, ++seed );
+        ls::static_search_tree< type, tag > tree( values.begin(), values.end() );
+
+        std::ostringstream out;
+        tree.save( out );
+        std::string saved = out.str();
+        ASSERT_EQ( 0u, saved.size() % 64 ) << "Size " << n;
+
+        // The parallel build writes the same tree
+        for( size_t threads : { 0, 1, 3, 64 } )
+        {
+            std::ostringstream parallel;
+            ls::static_search_tree< type, tag >( values.begin(), values.end(), threads ).save( parallel );
+            EXPECT_TRUE( saved == parallel.str() ) << "Size " << n << " threads " << threads;
+        }
+
+        // As a file mapped on the memory
+        ls::vector< char > buffer( saved.begin(), saved.end() );
+        ls::static_search_tree_view< type, tag > view( buffer.data(), buffer.size() );
+        ASSERT_TRUE( view.valid() ) << "Size " << n;
+        ASSERT_EQ( n, view.size() );
+        EXPECT_EQ( tree.height(), view.height() ) << "Size " << n;
+        EXPECT_TRUE( std::equal( values.begin(), values.end(), view.begin() ) ) << "Size " << n;
+
+        for( type key : search_keys( values ) )
+        {
+            EXPECT_EQ( tree.lower_bound( key ) - tree.begin(), view.lower_bound( key ) - view.begin() ) << "Size " << n << " key " << +key;
+            EXPECT_EQ( tree.upper_bound( key ) - tree.begin(), view.upper_bound( key ) - view.begin() ) << "Size " << n << " key " << +key;
+            EXPECT_EQ( tree.contains( key ), view.contains( key ) ) << "Size " << n << " key " << +key;
+        }
+
+        // Truncated, misaligned or other key types are not valid
+        using other_type = typename std::conditional< std::is_same< type, double >::value, int64_t, double >::type;
+        EXPECT_FALSE( (ls::static_search_tree_view< other_type, tag >( buffer.data(), buffer.size() ).valid()) ) << "Size " << n;
+        EXPECT_FALSE( (ls::static_search_tree_view< type, tag >( buffer.data(), buffer.size() - 64 ).valid()) ) << "Size " << n;
+        buffer.insert( buffer.begin(), 0 );
+        EXPECT_FALSE( (ls::static_search_tree_view< type, tag >( buffer.data() + 1, buffer.size() - 1 ).valid()) ) << "Size " << n;
+    }
+}
+#endif //__SSE2__
+
+template <typename T> class CompressedTreeTypedTest: public ::testing::Test {};
+
+using CompressedTreeTypes = ::testing::Types<
+#ifdef __SSE2__
+    std::pair<int32_t, ls::sse_tag>, std::pair<int64_t, ls::sse_tag>,
+    std::pair<uint32_t, ls::sse_tag>, std::pair<uint64_t, ls::sse_tag>
+#ifdef __AVX2__
+    , std::pair<int32_t, ls::avx_tag>, std::pair<int64_t, ls::avx_tag>,
+    std::pair<uint32_t, ls::avx_tag>, std::pair<uint64_t, ls::avx_tag>
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(CompressedTreeTypedTest, CompressedTreeTypes);
+
+#ifdef __SSE2__
+TYPED_TEST(CompressedTreeTypedTest, CompressedSearchTreeTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    // Keys spread on the whole type, on a small range with repeated keys and on
+    // both ends of the type, where the codes of the separators collide
+    unsigned seed = 500;
+    for( uint64_t levels : { UINT64_C( 1 ) << 62, UINT64_C( 1000 ), UINT64_C( 3 ) } )
+    {
+        for( size_t n : { 0, 1, 15, 16, 17, 100, 1000, 4097, 40000 } )
+        {
+            auto values = sorted_values< type >( n, ++seed, levels );
+            if( n > 2 )
+            {
+                values.front() = std::numeric_limits< type >::lowest();
+                values.back() = std::numeric_limits< type >::max();
+            }
+
+            ls::compressed_search_tree< type, tag > tree( values.begin(), values.end() );
+            EXPECT_EQ( 0u, reinterpret_cast< uintptr_t >( tree.begin() ) % 64 ) << "Size " << n;
+            check_sorted_index( tree, values, search_keys( values ) );
+        }
+    }
+}
+#endif //__SSE2__
+
+template <typename T> class LearnedIndexTypedTest: public ::testing::Test {};
+
+using LearnedIndexTypes = ::testing::Types<
+#ifdef __SSE2__
+    std::pair<int32_t, ls::sse_tag>, std::pair<int64_t, ls::sse_tag>,
+    std::pair<uint32_t, ls::sse_tag>, std::pair<uint64_t, ls::sse_tag>,
+    std::pair<float, ls::sse_tag>, std::pair<double, ls::sse_tag>
+#ifdef __AVX2__
+    , std::pair<int32_t, ls::avx_tag>, std::pair<int64_t, ls::avx_tag>,
+    std::pair<uint32_t, ls::avx_tag>, std::pair<uint64_t, ls::avx_tag>,
+    std::pair<float, ls::avx_tag>, std::pair<double, ls::avx_tag>
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(LearnedIndexTypedTest, LearnedIndexTypes);
+
+#ifdef __SSE2__
+TYPED_TEST(LearnedIndexTypedTest, LearnedIndexTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using index_type = ls::learned_index< type, tag >;
+
+    // Keys spread on the whole type and on a small range with long runs of repeated keys
+    unsigned seed = 600;
+    for( uint64_t levels : { UINT64_C( 1 ) << 62, UINT64_C( 1000 ), UINT64_C( 3 ) } )
+    {
+        for( size_t n : { 0, 1, 15, 16, 17, 100, 1000, 4097, 40000 } )
+        {
+            auto values = sorted_values< type >( n, ++seed, levels );
+            if( n > 2 && levels > 3 )
+            {
+                values.front() = std::numeric_limits< type >::lowest();
+                values.back() = std::numeric_limits< type >::max();
+            }
+            check_sorted_index( index_type( values.begin(), values.end() ), values, search_keys( values ) );
+        }
+    }
+
+    // A smooth sequence fits on a single segment
+    std::mt19937_64 gen( seed );
+    for( size_t n : { 1, 100, 40000 } )
+    {
+        std::vector< type > values;
+        for( size_t i = 0; i < n; ++i )
+            values.push_back( static_cast< type >( i * 10 + gen() % 5 ) );
+
+        index_type index( values.begin(), values.end() );
+        EXPECT_EQ( 1u, index.segments() ) << "Size " << n;
+        check_sorted_index( index, values, search_keys( values ) );
+    }
+}
+#endif //__SSE2__
+
+TEST(SearchTest, IteratorTest)
+{
+    std::deque< int32_t > values;
+    for( int32_t i = 0; i < 5000; ++i )
+        values.push_back( i / 3 );
+
+    for( int32_t key = -1; key < 1700; key += 7 )
+    {
+        EXPECT_EQ( std::lower_bound( values.begin(), values.end(), key ),
+                   ls::lower_bound( values.begin(), values.end(), key ) ) << "Key " << key;
+        EXPECT_EQ( std::upper_bound( values.begin(), values.end(), key ),
+                   ls::upper_bound( values.begin(), values.end(), key ) ) << "Key " << key;
+        EXPECT_EQ( std::lower_bound( values.begin(), values.end(), key ),
+                   ls::interpolation_lower_bound( values.begin(), values.end(), key ) ) << "Key " << key;
+    }
+
+    // Value types without SIMD registers use the standard search
+    std::vector< std::string > names = { "a", "b", "c", "c", "d" };
+    auto range = ls::equal_range( names.begin(), names.end(), std::string( "c" ) );
+    EXPECT_EQ( 2, range.first - names.begin() );
+    EXPECT_EQ( 4, range.second - names.begin() );
+}
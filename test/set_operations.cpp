@@ -0,0 +1,148 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <set>
+#include <vector>
+#include <random>
+#include <iterator>
+#include <algorithm>
+#include <litesimd/types.h>
+#include <litesimd/algorithm.h>
+#include "gtest/gtest.h"
+
+namespace ls = litesimd;
+
+template <typename T> class SetOperationsTypedTest: public ::testing::Test {};
+
+using TestTypes = ::testing::Types<
+#ifdef __SSE2__
+    std::pair<int32_t, ls::sse_tag>, std::pair<uint32_t, ls::sse_tag>,
+    std::pair<int64_t, ls::sse_tag>, std::pair<uint64_t, ls::sse_tag>
+#ifdef __AVX2__
+    , std::pair<int32_t, ls::avx_tag>, std::pair<uint32_t, ls::avx_tag>,
+    std::pair<int64_t, ls::avx_tag>, std::pair<uint64_t, ls::avx_tag>
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(SetOperationsTypedTest, TestTypes);
+
+#ifdef __SSE2__
+// Sorted set with _size_ values from [offset, offset + range), crossing the sign bit
+template< typename Type_T >
+std::vector< Type_T > random_set( size_t size, uint64_t range, uint64_t offset, std::mt19937& gen )
+{
+    std::uniform_int_distribution< uint64_t > dist( 0, range - 1 );
+    std::set< Type_T > values;
+    while( values.size() < size )
+        values.insert( static_cast< Type_T >( offset + dist( gen ) ) );
+    return std::vector< Type_T >( values.begin(), values.end() );
+}
+
+TYPED_TEST(SetOperationsTypedTest, SetOperationsTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    const size_t sizes[] = { 0, 1, 3, 8, 17, 100, 1000, 5000 };
+    const uint64_t offset = static_cast< uint64_t >( std::numeric_limits< type >::max() ) - 5000;
+    std::mt19937 gen( 1 );
+    for( size_t na : sizes )
+    {
+        for( size_t nb : sizes )
+        {
+            auto a = random_set< type >( na, 2 * (na + nb) + 1, offset, gen );
+            auto b = random_set< type >( nb, 2 * (na + nb) + 1, offset, gen );
+            std::vector< type > out( na + nb );
+            std::vector< type > expected;
+
+            std::set_intersection( a.begin(), a.end(), b.begin(), b.end(), std::back_inserter( expected ) );
+            std::vector< type > result( out.data(), ls::set_intersection< tag >(
+                                            a.data(), a.data() + na, b.data(), b.data() + nb, out.data() ) );
+            EXPECT_TRUE( expected == result ) << "Intersection sizes " << na << ", " << nb;
+            EXPECT_EQ( expected.size(), ls::set_intersection_count< tag >(
+                                            a.data(), a.data() + na, b.data(), b.data() + nb ) );
+
+            expected.clear();
+            std::set_union( a.begin(), a.end(), b.begin(), b.end(), std::back_inserter( expected ) );
+            result.assign( out.data(), ls::set_union< tag >(
+                                            a.data(), a.data() + na, b.data(), b.data() + nb, out.data() ) );
+            EXPECT_TRUE( expected == result ) << "Union sizes " << na << ", " << nb;
+            EXPECT_EQ( expected.size(), ls::set_union_count< tag >(
+                                            a.data(), a.data() + na, b.data(), b.data() + nb ) );
+
+            expected.clear();
+            std::set_difference( a.begin(), a.end(), b.begin(), b.end(), std::back_inserter( expected ) );
+            result.assign( out.data(), ls::set_difference< tag >(
+                                            a.data(), a.data() + na, b.data(), b.data() + nb, out.data() ) );
+            EXPECT_TRUE( expected == result ) << "Difference sizes " << na << ", " << nb;
+            EXPECT_EQ( expected.size(), ls::set_difference_count< tag >(
+                                            a.data(), a.data() + na, b.data(), b.data() + nb ) );
+        }
+    }
+}
+
+TYPED_TEST(SetOperationsTypedTest, UnionFirstValueTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    // The lowest value of b differs only on the last bit from the first value of a
+    std::vector< type > a = { 5 }, b = { 4 };
+    for( type i = 1; i < 20; ++i )
+    {
+        a.push_back( 10 * i );
+        b.push_back( 10 * i + 1 );
+    }
+    std::vector< type > expected;
+    std::set_union( a.begin(), a.end(), b.begin(), b.end(), std::back_inserter( expected ) );
+
+    std::vector< type > out( a.size() + b.size() );
+    std::vector< type > result( out.data(), ls::set_union< tag >(
+                                    a.data(), a.data() + a.size(), b.data(), b.data() + b.size(), out.data() ) );
+    EXPECT_TRUE( expected == result );
+    EXPECT_EQ( expected.size(), ls::set_union_count< tag >(
+                                    a.data(), a.data() + a.size(), b.data(), b.data() + b.size() ) );
+
+    result.assign( out.data(), ls::set_union< tag >(
+                       b.data(), b.data() + b.size(), a.data(), a.data() + a.size(), out.data() ) );
+    EXPECT_TRUE( expected == result );
+}
+
+TYPED_TEST(SetOperationsTypedTest, OutputBoundsTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    // The output has exactly the room documented, the guard value must be kept
+    std::vector< type > a, b;
+    for( type i = 0; i < 100; ++i )
+    {
+        a.push_back( 2 * i );
+        b.push_back( 3 * i );
+    }
+    std::vector< type > out( a.size() + 1, 7 );
+    type* last = ls::set_difference< tag >( a.data(), a.data() + a.size(),
+                                            b.data(), b.data() + b.size(), out.data() );
+    EXPECT_EQ( static_cast< type >( 7 ), out.back() );
+    EXPECT_EQ( 66, last - out.data() );
+}
+#endif //__SSE2__
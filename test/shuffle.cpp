@@ -20,7 +20,9 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <cstring>
 #include <litesimd/types.h>
+#include <litesimd/memory.h>
 #include <litesimd/shuffle.h>
 #include <litesimd/algorithm.h>
 #include <litesimd/helpers/iostream.h>
@@ -44,6 +46,20 @@ using TestTypes = ::testing::Types<
 >;
 TYPED_TEST_CASE(ShuffleTypedTest, TestTypes);
 
+template <typename T> class PermuteTypedTest: public ::testing::Test {};
+
+using PermuteTypes = ::testing::Types<
+#ifdef __SSE2__
+    std::pair<int32_t, ls::sse_tag>, std::pair<int64_t, ls::sse_tag>,
+    std::pair<float, ls::sse_tag>, std::pair<double, ls::sse_tag>
+#ifdef __AVX2__
+    , std::pair<int32_t, ls::avx_tag>, std::pair<int64_t, ls::avx_tag>,
+    std::pair<float, ls::avx_tag>, std::pair<double, ls::avx_tag>
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(PermuteTypedTest, PermuteTypes);
+
 #ifdef __SSE2__
 TEST(BaseTest, Set1FloatTest)
 {
@@ -118,4 +134,88 @@ TYPED_TEST(ShuffleTypedTest, LowInsertTest)
         return true;
     } );
 }
+
+TYPED_TEST(ShuffleTypedTest, ReverseTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using simd = ls::simd_type< type, tag >;
+
+    simd a = ls::reverse( ls::iota< type, tag >( 1 ) );
+    ls::for_each( a, [&a]( int index, type val )
+    {
+        EXPECT_EQ( static_cast<type>( simd::simd_size - index ), val ) << "Error on index " << index << ", Simd: " << a;
+        return true;
+    } );
+}
+
+TYPED_TEST(PermuteTypedTest, PermuteTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using simd = ls::simd_type< type, tag >;
+    using index_type = typename ls::permute_index< type >::type;
+    using index_simd = ls::simd_type< index_type, tag >;
+
+    simd a = ls::iota< type, tag >( 10 );
+
+    // Rotate one index
+    index_type rotate[ simd::simd_size ];
+    for( size_t i = 0; i < simd::simd_size; ++i )
+        rotate[ i ] = static_cast< index_type >( (i + 1) % simd::simd_size );
+
+    simd b = ls::permute( a, ls::load< index_type, tag >( rotate ) );
+    ls::for_each( b, [&b]( int index, type val )
+    {
+        EXPECT_EQ( static_cast<type>( 10 + (index + 1) % simd::simd_size ), val ) << "Error on index " << index << ", Simd: " << b;
+        return true;
+    } );
+
+    // Broadcast the highest index
+    b = ls::permute( a, index_simd( static_cast< index_type >( simd::simd_size - 1 ) ) );
+    ls::for_each( b, [&b]( int index, type val )
+    {
+        EXPECT_EQ( static_cast<type>( 10 + simd::simd_size - 1 ), val ) << "Error on index " << index << ", Simd: " << b;
+        return true;
+    } );
+
+    // Reinterpret keeps the bits
+    auto bits = ls::reinterpret< index_type >( a );
+    EXPECT_EQ( 0, std::memcmp( &bits, &a, sizeof( a ) ) );
+    simd c = ls::reinterpret< type >( bits );
+    EXPECT_EQ( 0, std::memcmp( &c, &a, sizeof( a ) ) );
+}
+
+TYPED_TEST(PermuteTypedTest, CompressTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using simd = ls::simd_type< type, tag >;
+    constexpr size_t size = simd::simd_size;
+
+    simd a = ls::iota< type, tag >( 10 );
+    for( int bits = 0; bits < (1 << size); ++bits )
+    {
+        type in[ size ];
+        type expected[ size ];
+        size_t count = 0;
+        ls::store< type, tag >( in, a );
+        for( size_t i = 0; i < size; ++i )
+            if( bits & (1 << i) )
+                expected[ count++ ] = in[ i ];
+        for( size_t i = 0; i < size; ++i )
+            if( !(bits & (1 << i)) )
+                expected[ count++ ] = in[ i ];
+
+        // Selects the lanes by comparing with a reference register
+        type ref[ size ];
+        for( size_t i = 0; i < size; ++i )
+            ref[ i ] = (bits & (1 << i)) ? in[ i ] - 1 : in[ i ];
+        simd mask = ls::greater< type, tag >( a, ls::load< type, tag >( ref ) );
+
+        type out[ size ];
+        ls::store< type, tag >( out, ls::compress< type, tag >( mask, a ) );
+        EXPECT_TRUE( std::equal( expected, expected + size, out ) ) << "Error on bits " << bits;
+    }
+}
 #endif // __SSE2__
@@ -0,0 +1,470 @@
+// MIT License
+//
+// Copyright (c) 2018 André Tupinambá
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vector>
+#include <iterator>
+#include <random>
+#include <limits>
+#include <algorithm>
+#include <numeric>
+#include <litesimd/types.h>
+#include <litesimd/memory.h>
+#include <litesimd/algorithm.h>
+#include <litesimd/helpers/iostream.h>
+#include "gtest/gtest.h"
+
+namespace ls = litesimd;
+
+template <typename T> class SortingTypedTest: public ::testing::Test {};
+
+using TestTypes = ::testing::Types<
+#ifdef __SSE2__
+    std::pair<int32_t, ls::sse_tag>, std::pair<int64_t, ls::sse_tag>,
+    std::pair<float, ls::sse_tag>, std::pair<double, ls::sse_tag>
+#ifdef __AVX2__
+    , std::pair<int32_t, ls::avx_tag>, std::pair<int64_t, ls::avx_tag>,
+    std::pair<float, ls::avx_tag>, std::pair<double, ls::avx_tag>
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(SortingTypedTest, TestTypes);
+
+#ifdef __SSE2__
+template< typename Type_T >
+std::vector< Type_T > random_values( size_t size, int range, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > dist( -range, range );
+    std::vector< Type_T > ret( size );
+    for( auto& v : ret )
+        v = static_cast< Type_T >( dist( gen ) );
+    return ret;
+}
+
+TYPED_TEST(SortingTypedTest, SortingNetworkTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using simd = ls::simd_type< type, tag >;
+    using payload_type = typename ls::permute_index< type >::type;
+    using payload_simd = ls::simd_type< payload_type, tag >;
+    constexpr size_t size = simd::simd_size;
+
+    for( unsigned seed = 0; seed < 200; ++seed )
+    {
+        // Small range to test repeated keys
+        auto values = random_values< type >( 4 * size, seed % 2 ? 3 : 1000, seed );
+        std::vector< type > expected( values.begin(), values.begin() + size );
+        std::sort( expected.begin(), expected.end() );
+
+        type out[ 4 * size ];
+        ls::store< type, tag >( out, ls::bitonic_sort( ls::load< type, tag >( values.data() ) ) );
+        EXPECT_TRUE( std::equal( expected.begin(), expected.end(), out ) ) << "Seed " << seed;
+
+        ls::store< type, tag >( out, ls::odd_even_merge_sort( ls::load< type, tag >( values.data() ) ) );
+        EXPECT_TRUE( std::equal( expected.begin(), expected.end(), out ) ) << "Seed " << seed;
+
+        // Payload holds the original index of the key
+        simd keys = ls::load< type, tag >( values.data() );
+        payload_simd payload = ls::iota< payload_type, tag >( 0 );
+        ls::bitonic_sort( keys, payload );
+        payload_type index[ size ];
+        ls::store< type, tag >( out, keys );
+        ls::store< payload_type, tag >( index, payload );
+        EXPECT_TRUE( std::equal( expected.begin(), expected.end(), out ) ) << "Seed " << seed;
+        for( size_t i = 0; i < size; ++i )
+            EXPECT_EQ( out[ i ], values[ index[ i ] ] ) << "Seed " << seed << " index " << i;
+
+        keys = ls::load< type, tag >( values.data() );
+        payload = ls::iota< payload_type, tag >( 0 );
+        ls::odd_even_merge_sort( keys, payload );
+        ls::store< type, tag >( out, keys );
+        ls::store< payload_type, tag >( index, payload );
+        EXPECT_TRUE( std::equal( expected.begin(), expected.end(), out ) ) << "Seed " << seed;
+        for( size_t i = 0; i < size; ++i )
+            EXPECT_EQ( out[ i ], values[ index[ i ] ] ) << "Seed " << seed << " index " << i;
+
+        // Several registers
+        expected = values;
+        std::sort( expected.begin(), expected.end() );
+
+        simd regs[ 4 ];
+        for( size_t i = 0; i < 4; ++i )
+            regs[ i ] = ls::load< type, tag >( values.data() + i * size );
+        ls::bitonic_sort( regs );
+        for( size_t i = 0; i < 4; ++i )
+            ls::store< type, tag >( out + i * size, regs[ i ] );
+        EXPECT_TRUE( std::equal( expected.begin(), expected.end(), out ) ) << "Seed " << seed;
+
+        payload_simd pregs[ 4 ];
+        payload_type pindex[ 4 * size ];
+        for( size_t i = 0; i < 4; ++i )
+        {
+            regs[ i ] = ls::load< type, tag >( values.data() + i * size );
+            pregs[ i ] = ls::iota< payload_type, tag >( static_cast< payload_type >( i * size ) );
+        }
+        ls::odd_even_merge_sort( regs, pregs );
+        for( size_t i = 0; i < 4; ++i )
+        {
+            ls::store< type, tag >( out + i * size, regs[ i ] );
+            ls::store< payload_type, tag >( pindex + i * size, pregs[ i ] );
+        }
+        EXPECT_TRUE( std::equal( expected.begin(), expected.end(), out ) ) << "Seed " << seed;
+        for( size_t i = 0; i < 4 * size; ++i )
+            EXPECT_EQ( out[ i ], values[ pindex[ i ] ] ) << "Seed " << seed << " index " << i;
+    }
+}
+
+TYPED_TEST(SortingTypedTest, BitonicMergeTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using simd = ls::simd_type< type, tag >;
+    constexpr size_t size = simd::simd_size;
+
+    for( unsigned seed = 0; seed < 100; ++seed )
+    {
+        auto values = random_values< type >( 2 * size, 100, seed );
+        std::sort( values.begin(), values.begin() + size );
+        std::sort( values.begin() + size, values.end() );
+
+        simd a = ls::load< type, tag >( values.data() );
+        simd b = ls::load< type, tag >( values.data() + size );
+        ls::bitonic_merge( a, b );
+
+        type out[ 2 * size ];
+        ls::store< type, tag >( out, a );
+        ls::store< type, tag >( out + size, b );
+        std::sort( values.begin(), values.end() );
+        EXPECT_TRUE( std::equal( values.begin(), values.end(), out ) ) << "Seed " << seed;
+    }
+}
+
+TYPED_TEST(SortingTypedTest, SortTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    constexpr size_t size = ls::simd_type< type, tag >::simd_size;
+
+    const size_t sizes[] = { 0, 1, size - 1, size, 2 * size + 1, 16 * size, 16 * size + 1,
+                             100, 1000, 4097, 100000 };
+    unsigned seed = 0;
+    for( size_t n : sizes )
+    {
+        // Small range to test repeated keys
+        for( int range : { 2, 100, 1000000 } )
+        {
+            auto values = random_values< type >( n, range, ++seed );
+            auto expected = values;
+            std::sort( expected.begin(), expected.end() );
+
+            ls::sort< tag >( values.data(), values.data() + n );
+            EXPECT_TRUE( values == expected ) << "Size " << n << " range " << range;
+
+            // Already sorted and reversed inputs
+            ls::sort< tag >( values.data(), values.data() + n );
+            EXPECT_TRUE( values == expected ) << "Size " << n << " range " << range;
+
+            std::reverse( values.begin(), values.end() );
+            ls::sort< tag >( values.data(), values.data() + n );
+            EXPECT_TRUE( values == expected ) << "Size " << n << " range " << range;
+        }
+    }
+
+    // All equal and extreme values
+    std::vector< type > values( 5000, static_cast< type >( 7 ) );
+    values[ 10 ] = std::numeric_limits< type >::max();
+    values[ 20 ] = std::numeric_limits< type >::lowest();
+    auto expected = values;
+    std::sort( expected.begin(), expected.end() );
+    ls::sort< tag >( values.data(), values.data() + values.size() );
+    EXPECT_TRUE( values == expected );
+
+    // NaN values go to the end, the other ones are sorted
+    if( std::numeric_limits< type >::has_quiet_NaN )
+    {
+        for( size_t n : { size_t( 100 ), size_t( 5000 ) } )
+        {
+            values = random_values< type >( n, 1000000, ++seed );
+            for( size_t i = 0; i < n; i += 10 )
+                values[ (i * 7) % n ] = std::numeric_limits< type >::quiet_NaN();
+            expected.clear();
+            std::copy_if( values.begin(), values.end(), std::back_inserter( expected ),
+                          []( type v ){ return v == v; } );
+            std::sort( expected.begin(), expected.end() );
+
+            ls::sort< tag >( values.data(), values.data() + n );
+            EXPECT_TRUE( std::equal( expected.begin(), expected.end(), values.begin() ) ) << "Size " << n;
+            EXPECT_TRUE( std::all_of( values.begin() + expected.size(), values.end(),
+                                      []( type v ){ return v != v; } ) ) << "Size " << n;
+        }
+    }
+}
+
+TYPED_TEST(SortingTypedTest, MergeTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using payload_type = typename ls::permute_index< type >::type;
+    constexpr size_t size = ls::simd_type< type, tag >::simd_size;
+
+    const size_t sizes[] = { 0, 1, size - 1, size, size + 1, 3 * size, 100, 1000 };
+    unsigned seed = 0;
+    for( size_t na : sizes )
+    {
+        for( size_t nb : sizes )
+        {
+            for( int range : { 3, 1000000 } )
+            {
+                auto a = random_values< type >( na, range, ++seed );
+                auto b = random_values< type >( nb, range, ++seed );
+                std::sort( a.begin(), a.end() );
+                std::sort( b.begin(), b.end() );
+
+                std::vector< type > expected( na + nb );
+                std::merge( a.begin(), a.end(), b.begin(), b.end(), expected.begin() );
+
+                std::vector< type > out( na + nb );
+                type* last = ls::merge< tag >( a.data(), a.data() + na, b.data(), b.data() + nb, out.data() );
+                EXPECT_EQ( out.data() + na + nb, last );
+                EXPECT_TRUE( out == expected ) << "Sizes " << na << ", " << nb << " range " << range;
+
+                // Payload holds the index of the key, b indexes after a indexes
+                std::vector< payload_type > pa( na ), pb( nb ), pout( na + nb );
+                for( size_t i = 0; i < na; ++i )
+                    pa[ i ] = static_cast< payload_type >( i );
+                for( size_t i = 0; i < nb; ++i )
+                    pb[ i ] = static_cast< payload_type >( na + i );
+
+                std::fill( out.begin(), out.end(), type() );
+                last = ls::merge< tag >( a.data(), a.data() + na, pa.data(),
+                                         b.data(), b.data() + nb, pb.data(), out.data(), pout.data() );
+                EXPECT_EQ( out.data() + na + nb, last );
+                EXPECT_TRUE( out == expected ) << "Sizes " << na << ", " << nb << " range " << range;
+
+                std::vector< payload_type > indexes( pout );
+                std::sort( indexes.begin(), indexes.end() );
+                for( size_t i = 0; i < na + nb; ++i )
+                {
+                    EXPECT_EQ( static_cast< payload_type >( i ), indexes[ i ] );
+                    type key = pout[ i ] < static_cast< payload_type >( na ) ? a[ pout[ i ] ] : b[ pout[ i ] - na ];
+                    EXPECT_EQ( out[ i ], key ) << "Sizes " << na << ", " << nb << " index " << i;
+                }
+            }
+        }
+    }
+}
+
+TYPED_TEST(SortingTypedTest, UniqueTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    const size_t sizes[] = { 0, 1, 2, 7, 8, 9, 33, 1000 };
+    unsigned seed = 0;
+    for( size_t n : sizes )
+    {
+        for( int range : { 1, 5, 1000000 } )
+        {
+            auto values = random_values< type >( n, range, ++seed );
+            std::sort( values.begin(), values.end() );
+
+            std::vector< type > expected( values );
+            expected.erase( std::unique( expected.begin(), expected.end() ), expected.end() );
+
+            std::vector< type > out( n );
+            type* last = ls::unique_copy< tag >( values.data(), values.data() + n, out.data() );
+            EXPECT_TRUE( std::equal( expected.begin(), expected.end(), out.data() ) ) << "Size " << n;
+            EXPECT_EQ( expected.size(), static_cast< size_t >( last - out.data() ) ) << "Size " << n;
+
+            EXPECT_EQ( expected.size(), ls::unique_count< tag >( values.data(), values.data() + n ) );
+
+            last = ls::unique< tag >( values.data(), values.data() + n );
+            values.resize( last - values.data() );
+            EXPECT_TRUE( values == expected ) << "Size " << n << " range " << range;
+        }
+    }
+}
+
+TYPED_TEST(SortingTypedTest, PartitionTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+    using simd = ls::simd_type< type, tag >;
+    constexpr size_t size = simd::simd_size;
+
+    const size_t sizes[] = { 0, 1, size, 2 * size - 1, 2 * size, 3 * size + 1, 100, 1001 };
+    unsigned seed = 0;
+    for( size_t n : sizes )
+    {
+        for( int pivot : { -2000, -50, 0, 3, 2000 } )
+        {
+            auto values = random_values< type >( n, 100, ++seed );
+            auto sorted = values;
+            std::sort( sorted.begin(), sorted.end() );
+
+            type* mid = ls::partition< tag >( values.data(), values.data() + n, static_cast< type >( pivot ) );
+            ptrdiff_t expected = std::lower_bound( sorted.begin(), sorted.end(),
+                                                   static_cast< type >( pivot ) ) - sorted.begin();
+            EXPECT_EQ( expected, mid - values.data() ) << "Size " << n << " pivot " << pivot;
+            EXPECT_TRUE( std::all_of( values.data(), mid, [pivot]( type v ){ return v < pivot; } ) );
+            std::sort( values.begin(), values.end() );
+            EXPECT_TRUE( values == sorted ) << "Size " << n << " pivot " << pivot;
+        }
+
+        // Predicate partition, non negative values first
+        auto values = random_values< type >( n, 100, ++seed );
+        type* mid = ls::partition< tag >( values.data(), values.data() + n,
+            []( simd v ) { return ls::greater< type, tag >( v, simd( -1 ) ); },
+            []( type v ) { return v > -1; } );
+        EXPECT_TRUE( std::all_of( values.data(), mid, []( type v ){ return v >= 0; } ) );
+        EXPECT_TRUE( std::all_of( mid, values.data() + n, []( type v ){ return v < 0; } ) );
+    }
+}
+
+TYPED_TEST(SortingTypedTest, NthElementTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    const size_t sizes[] = { 1, 7, 100, 1000, 20000 };
+    unsigned seed = 0;
+    for( size_t n : sizes )
+    {
+        for( int range : { 2, 1000000 } )
+        {
+            auto values = random_values< type >( n, range, ++seed );
+            auto sorted = values;
+            std::sort( sorted.begin(), sorted.end() );
+
+            for( size_t k : { size_t( 0 ), n / 2, n * 9 / 10, n - 1 } )
+            {
+                auto selected = values;
+                ls::nth_element< tag >( selected.data(), selected.data() + k, selected.data() + n );
+                EXPECT_EQ( sorted[ k ], selected[ k ] ) << "Size " << n << " nth " << k;
+                EXPECT_TRUE( std::all_of( selected.begin(), selected.begin() + k,
+                                          [&]( type v ){ return !(selected[ k ] < v); } ) );
+                EXPECT_TRUE( std::all_of( selected.begin() + k, selected.end(),
+                                          [&]( type v ){ return !(v < selected[ k ]); } ) );
+
+                auto partial = values;
+                ls::partial_sort< tag >( partial.data(), partial.data() + k, partial.data() + n );
+                EXPECT_TRUE( std::equal( sorted.begin(), sorted.begin() + k, partial.begin() ) )
+                    << "Size " << n << " middle " << k;
+            }
+        }
+    }
+
+    // NaN values are after all the other ones
+    if( std::numeric_limits< type >::has_quiet_NaN )
+    {
+        const size_t n = 5000;
+        auto values = random_values< type >( n, 1000000, ++seed );
+        for( size_t i = 0; i < n; i += 10 )
+            values[ (i * 7) % n ] = std::numeric_limits< type >::quiet_NaN();
+        std::vector< type > sorted;
+        std::copy_if( values.begin(), values.end(), std::back_inserter( sorted ),
+                      []( type v ){ return v == v; } );
+        std::sort( sorted.begin(), sorted.end() );
+
+        for( size_t k : { size_t( 0 ), sorted.size() / 2, sorted.size() - 1, sorted.size() + 10 } )
+        {
+            auto selected = values;
+            ls::nth_element< tag >( selected.data(), selected.data() + k, selected.data() + n );
+            if( k < sorted.size() )
+            {
+                EXPECT_EQ( sorted[ k ], selected[ k ] ) << "Nth " << k;
+                EXPECT_TRUE( std::all_of( selected.begin(), selected.begin() + k,
+                                          [&]( type v ){ return v <= selected[ k ]; } ) ) << "Nth " << k;
+            }
+            else
+            {
+                EXPECT_TRUE( selected[ k ] != selected[ k ] ) << "Nth " << k;
+            }
+
+            auto partial = values;
+            size_t middle = std::min( k, sorted.size() );
+            ls::partial_sort< tag >( partial.data(), partial.data() + middle, partial.data() + n );
+            EXPECT_TRUE( std::equal( sorted.begin(), sorted.begin() + middle, partial.begin() ) ) << "Middle " << middle;
+        }
+    }
+}
+#endif //__SSE2__
+
+template <typename T> class RadixSortTypedTest: public ::testing::Test {};
+
+using RadixTypes = ::testing::Types<
+#ifdef __SSE2__
+    std::pair<uint32_t, ls::sse_tag>, std::pair<uint64_t, ls::sse_tag>
+#ifdef __AVX2__
+    , std::pair<uint32_t, ls::avx_tag>, std::pair<uint64_t, ls::avx_tag>
+#endif //__AVX2__
+#endif //__SSE2__
+>;
+TYPED_TEST_CASE(RadixSortTypedTest, RadixTypes);
+
+#ifdef __SSE2__
+TYPED_TEST(RadixSortTypedTest, RadixSortTest)
+{
+    using type = typename TypeParam::first_type;
+    using tag = typename TypeParam::second_type;
+
+    std::mt19937_64 gen( 1 );
+    for( size_t n : { 0, 1, 2, 7, 100, 1000, 4097, 100000 } )
+    {
+        // Full range, small range and only high bits set
+        for( int shift : { 0, 8 * (int) sizeof( type ) - 6, 8 * (int) sizeof( type ) - 12 } )
+        {
+            std::vector< type > keys( n );
+            for( auto& k : keys )
+                k = static_cast< type >( gen() ) >> shift << (shift % 7);
+
+            std::vector< uint32_t > payload( n );
+            std::iota( payload.begin(), payload.end(), 0 );
+
+            std::vector< std::pair< type, uint32_t > > expected( n );
+            for( size_t i = 0; i < n; ++i )
+                expected[ i ] = std::make_pair( keys[ i ], payload[ i ] );
+            std::stable_sort( expected.begin(), expected.end(),
+                              []( const std::pair< type, uint32_t >& a, const std::pair< type, uint32_t >& b )
+                              { return a.first < b.first; } );
+
+            std::vector< type > only_keys( keys );
+            std::vector< type > wide_keys( keys );
+            std::vector< type > narrow_keys( keys );
+            ls::radix_sort< tag >( keys.data(), n, payload.data() );
+            ls::radix_sort< tag >( only_keys.data(), n );
+            ls::radix_sort< tag, 11 >( wide_keys.data(), n );
+            ls::radix_sort< tag, 3 >( narrow_keys.data(), n );
+
+            for( size_t i = 0; i < n; ++i )
+            {
+                ASSERT_EQ( expected[ i ].first, keys[ i ] ) << "Size " << n << " shift " << shift << " index " << i;
+                ASSERT_EQ( expected[ i ].second, payload[ i ] ) << "Size " << n << " shift " << shift << " index " << i;
+                ASSERT_EQ( expected[ i ].first, only_keys[ i ] ) << "Size " << n << " shift " << shift << " index " << i;
+                ASSERT_EQ( expected[ i ].first, wide_keys[ i ] ) << "Size " << n << " shift " << shift << " index " << i;
+                ASSERT_EQ( expected[ i ].first, narrow_keys[ i ] ) << "Size " << n << " shift " << shift << " index " << i;
+            }
+        }
+    }
+}
+#endif //__SSE2__